@@ -0,0 +1,354 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Multi-threaded batch runner
+//
+// Every job runs in a fresh instance context on a worker thread. With
+// POKEMINI_THREADS all core state is thread-local, so workers never touch
+// each other's memory while emulating. Jobs are dealt round-robin to the
+// workers, each takes from the bottom of its own queue and steals from the
+// top of the others once it runs dry, the queue locks are only taken
+// between jobs.
+
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+// PokeMini headers
+#include "PokeMini.h"
+#include "Hardware.h"
+#include "Video_Scale.h"
+#include "PokeMini_Batch.h"
+#include "PokeMini_BenchLoad.h"
+
+#ifndef POKEMINI_THREADS
+#error "PokeMini_Batch requires POKEMINI_THREADS"
+#endif
+
+#define POKEMINI_BATCH_MAXTHREADS	256
+#define POKEMINI_BATCH_MAXEVENTS	4096
+
+typedef struct {
+	int frame;
+	uint16_t keys;			// Bit set for each MINX_KEY_* held
+} TPokeMini_BatchEvent;
+
+typedef struct {
+	pthread_mutex_t lock;
+	int *jobs;			// Job indexes
+	int top, bottom;		// Steal from top, pop from bottom
+} TPokeMini_BatchQueue;
+
+typedef struct {
+	TPokeMini_BatchJob *jobs;
+	const TPokeMini_BatchConfig *config;
+	TPokeMini_BatchQueue *queues;
+	int threads;
+	int id;
+} TPokeMini_BatchWorker;
+
+uint64_t PokeMini_BatchClock(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+	return (uint64_t)clock() * (1000000000ULL / CLOCKS_PER_SEC);
+#endif
+}
+
+void PokeMini_BatchDefaults(TPokeMini_BatchConfig *config)
+{
+	config->threads = 0;
+	config->synccycles = 0;
+	config->idleskip = 0;
+}
+
+static uint64_t PokeMini_BatchHash(const void *data, uint32_t size)
+{
+	const uint8_t *ptr = (const uint8_t *)data;
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	uint32_t i;
+
+	if (!ptr) return 0;
+	for (i=0; i<size; i++) {
+		hash ^= ptr[i];
+		hash *= 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+// Parse input script, return number of events or -1 on error
+static int PokeMini_BatchLoadInput(const char *filename, TPokeMini_BatchEvent *events, int max)
+{
+	FILE *fi;
+	char line[PMTMPV], *ptr;
+	int num = 0, frame, key;
+	uint16_t keys;
+
+	fi = fopen(filename, "r");
+	if (!fi) return -1;
+	while (fgets(line, sizeof(line), fi)) {
+		ptr = strchr(line, ';');
+		if (ptr) *ptr = 0;
+		ptr = line;
+		while ((*ptr == ' ') || (*ptr == '\t')) ptr++;
+		if ((*ptr < '0') || (*ptr > '9')) continue;
+		frame = (int)strtol(ptr, &ptr, 10);
+		keys = 0;
+		for (; *ptr; ptr++) {
+			switch (*ptr) {
+				case 'A': case 'a': key = MINX_KEY_A; break;
+				case 'B': case 'b': key = MINX_KEY_B; break;
+				case 'C': case 'c': key = MINX_KEY_C; break;
+				case 'U': case 'u': key = MINX_KEY_UP; break;
+				case 'D': case 'd': key = MINX_KEY_DOWN; break;
+				case 'L': case 'l': key = MINX_KEY_LEFT; break;
+				case 'R': case 'r': key = MINX_KEY_RIGHT; break;
+				case 'P': case 'p': key = MINX_KEY_POWER; break;
+				default: key = MINX_KEY_NONE; break;
+			}
+			if (key) keys |= 1 << key;
+		}
+		if (num >= max) break;
+		events[num].frame = frame;
+		events[num].keys = keys;
+		num++;
+	}
+	fclose(fi);
+	return num;
+}
+
+// Blit the current frame and write it as a binary PPM
+static int PokeMini_BatchScreenshot(const char *filename)
+{
+	uint32_t video[96*64], pix;
+	uint8_t rgb[96*64*3];
+	FILE *fo;
+	int i;
+
+	PokeMini_VideoPalette_Init(PokeMini_BGR32, 1);
+	if (!PokeMini_SetVideo((TPokeMini_VideoSpec *)&PokeMini_Video1x1, 32, CommandLine.lcdfilter, CommandLine.lcdmode)) return 0;
+	PokeMini_VideoPalette_Index(CommandLine.palette, NULL, CommandLine.lcdcontrast, CommandLine.lcdbright);
+	PokeMini_VideoBlit(video, 96);
+	for (i=0; i<96*64; i++) {
+		pix = video[i];
+		rgb[i*3] = (uint8_t)(pix >> 16);
+		rgb[i*3+1] = (uint8_t)(pix >> 8);
+		rgb[i*3+2] = (uint8_t)pix;
+	}
+	fo = fopen(filename, "wb");
+	if (!fo) return 0;
+	fprintf(fo, "P6\n96 64\n255\n");
+	if (fwrite(rgb, 1, sizeof(rgb), fo) != sizeof(rgb)) {
+		fclose(fo);
+		return 0;
+	}
+	fclose(fo);
+	return 1;
+}
+
+// Emulate the job on the selected instance
+static int PokeMini_BatchEmulate(TPokeMini_BatchJob *job, const TPokeMini_BatchConfig *config, TPokeMini_BatchEvent *events)
+{
+	int numevents = 0, event = 0, i, key;
+	uint16_t keys = 0, changed;
+	int success = 1;
+
+	if (job->input) {
+		numevents = PokeMini_BatchLoadInput(job->input, events, POKEMINI_BATCH_MAXEVENTS);
+		if (numevents < 0) return 0;
+	}
+
+	CommandLineInit();
+	CommandLine.updatertc = 0;	// Keep runs deterministic
+	CommandLine.synccycles = config->synccycles;
+	CommandLine.idleskip = config->idleskip;
+	if (!PokeMini_Create(0, 4096)) return 0;
+	PokeMini_ApplyChanges();
+	MinxAudio_ChangeEngine(MINX_AUDIO_DISABLED);
+	if (!PokeMini_BenchLoadMIN(job->rom)) {
+		PokeMini_Destroy();
+		return 0;
+	}
+	MinxIO_FormatEEPROM();
+	PokeMini_Reset(1);
+
+	for (i=0; i<job->frames; i++) {
+		while ((event < numevents) && (events[event].frame <= i)) {
+			changed = keys ^ events[event].keys;
+			keys = events[event].keys;
+			for (key=MINX_KEY_A; key<=MINX_KEY_POWER; key++) {
+				if (changed & (1 << key)) MinxIO_Keypad(key, (keys >> key) & 1);
+			}
+			event++;
+		}
+		job->cycles += PokeMini_EmulateFrame();
+	}
+
+	job->hash_cpu = PokeMini_BatchHash(&MinxCPU, sizeof(MinxCPU));
+	job->hash_ram = PokeMini_BatchHash(PM_RAM, 8192);
+	job->hash_lcd = PokeMini_BatchHash(LCDPixelsD, 96*64);
+	job->hash_eeprom = PokeMini_BatchHash(EEPROM, 8192);
+	if (job->screenshot) success = PokeMini_BatchScreenshot(job->screenshot);
+
+	PokeMini_VideoPalette_Free();
+	PokeMini_Destroy();
+	return success;
+}
+
+int PokeMini_BatchRunJob(TPokeMini_BatchJob *job, const TPokeMini_BatchConfig *config)
+{
+	TPokeMini_BatchEvent *events;
+	TPokeMini_Context *ctx, *prev;
+	uint64_t start;
+	int success = 0;
+
+	job->status = -1;
+	job->cycles = 0;
+	job->hash_cpu = job->hash_ram = job->hash_lcd = job->hash_eeprom = 0;
+	job->seconds = 0.0;
+	start = PokeMini_BatchClock();
+
+	// Fresh instance, nothing carries over from the previous job
+	events = (TPokeMini_BatchEvent *)malloc(POKEMINI_BATCH_MAXEVENTS * sizeof(TPokeMini_BatchEvent));
+	ctx = PokeMini_NewContext();
+	prev = PokeMini_GetContext();
+	if (events && ctx && PokeMini_SelectContext(ctx)) {
+		success = PokeMini_BatchEmulate(job, config, events);
+		PokeMini_SelectContext(prev);
+	}
+	PokeMini_FreeContext(ctx);
+	free(events);
+
+	job->seconds = (double)(PokeMini_BatchClock() - start) / 1e9;
+	if (success) job->status = 1;
+	return success;
+}
+
+int PokeMini_BatchThreads(const TPokeMini_BatchConfig *config, int num)
+{
+	int threads = config->threads;
+
+	if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads <= 0) threads = 1;
+	if (threads > POKEMINI_BATCH_MAXTHREADS) threads = POKEMINI_BATCH_MAXTHREADS;
+	if (threads > num) threads = num;
+	return threads;
+}
+
+// Next job index for a worker, -1 when there is no work left
+static int PokeMini_BatchNextJob(TPokeMini_BatchWorker *worker)
+{
+	TPokeMini_BatchQueue *queue;
+	int i, job = -1;
+
+	// Own queue first, newest job
+	queue = &worker->queues[worker->id];
+	pthread_mutex_lock(&queue->lock);
+	if (queue->bottom > queue->top) job = queue->jobs[--queue->bottom];
+	pthread_mutex_unlock(&queue->lock);
+	if (job >= 0) return job;
+
+	// Steal the oldest job from the others
+	for (i=1; i<worker->threads; i++) {
+		queue = &worker->queues[(worker->id + i) % worker->threads];
+		pthread_mutex_lock(&queue->lock);
+		if (queue->bottom > queue->top) job = queue->jobs[queue->top++];
+		pthread_mutex_unlock(&queue->lock);
+		if (job >= 0) return job;
+	}
+	return -1;
+}
+
+static void *PokeMini_BatchWorkerThread(void *data)
+{
+	TPokeMini_BatchWorker *worker = (TPokeMini_BatchWorker *)data;
+	int job;
+
+	while ((job = PokeMini_BatchNextJob(worker)) >= 0) {
+		PokeMini_BatchRunJob(&worker->jobs[job], worker->config);
+	}
+	return NULL;
+}
+
+int PokeMini_BatchRun(TPokeMini_BatchJob *jobs, int num, const TPokeMini_BatchConfig *config, double *seconds)
+{
+	TPokeMini_BatchQueue *queues;
+	TPokeMini_BatchWorker *workers;
+	pthread_t *tids;
+	int *order;
+	int threads;
+	int i, j, count, base = 0, done = 0, started = 0;
+	uint64_t start;
+
+	if (num <= 0) return 0;
+	threads = PokeMini_BatchThreads(config, num);
+	for (i=0; i<num; i++) jobs[i].status = 0;
+
+	queues = (TPokeMini_BatchQueue *)calloc(threads, sizeof(TPokeMini_BatchQueue));
+	workers = (TPokeMini_BatchWorker *)calloc(threads, sizeof(TPokeMini_BatchWorker));
+	tids = (pthread_t *)calloc(threads, sizeof(pthread_t));
+	order = (int *)malloc(num * sizeof(int));
+	if (!queues || !workers || !tids || !order) {
+		free(order);
+		free(queues);
+		free(workers);
+		free(tids);
+		return 0;
+	}
+
+	// Deal jobs round-robin, lowest index at the bottom of each queue
+	for (i=0; i<threads; i++) {
+		count = (num - i + threads - 1) / threads;
+		pthread_mutex_init(&queues[i].lock, NULL);
+		queues[i].jobs = order + base;
+		for (j=0; j<count; j++) queues[i].jobs[j] = i + (count - 1 - j) * threads;
+		queues[i].bottom = count;
+		base += count;
+		workers[i].jobs = jobs;
+		workers[i].config = config;
+		workers[i].queues = queues;
+		workers[i].threads = threads;
+		workers[i].id = i;
+	}
+
+	start = PokeMini_BatchClock();
+	for (i=0; i<threads; i++) {
+		if (pthread_create(&tids[i], NULL, PokeMini_BatchWorkerThread, &workers[i])) break;
+		started++;
+	}
+	// Remaining work is stolen by the running workers
+	if (!started) PokeMini_BatchWorkerThread(&workers[0]);
+	for (i=0; i<started; i++) pthread_join(tids[i], NULL);
+	if (seconds) *seconds = (double)(PokeMini_BatchClock() - start) / 1e9;
+
+	for (i=0; i<threads; i++) pthread_mutex_destroy(&queues[i].lock);
+	free(order);
+	free(tids);
+	free(workers);
+	free(queues);
+
+	for (i=0; i<num; i++) if (jobs[i].status > 0) done++;
+	return done;
+}
@@ -0,0 +1,69 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_BATCH_H
+#define POKEMINI_BATCH_H
+
+#include <stdint.h>
+
+// Batch job, one emulator instance from a hard reset
+//   The input script is a text file with one "<frame> <keys>" pair per
+//   line, keys stay held from that frame until the next line. Keys are
+//   A, B, C, U(p), D(own), L(eft), R(ight) and P(ower), "-" for none.
+//   Everything after ';' is a comment
+typedef struct {
+	// Setup
+	const char *rom;		// ROM file (.min)
+	const char *input;		// Input script, NULL for none
+	const char *screenshot;		// PPM written after the last frame, NULL for none
+	int frames;			// Frames to emulate
+
+	// Results
+	int status;			// 1 = Done, 0 = Not run, -1 = Failed
+	uint64_t cycles;		// Emulated cycles
+	uint64_t hash_cpu;		// FNV-1a 64 of the CPU registers
+	uint64_t hash_ram;		// FNV-1a 64 of RAM
+	uint64_t hash_lcd;		// FNV-1a 64 of the LCD pixels
+	uint64_t hash_eeprom;		// FNV-1a 64 of the EEPROM
+	double seconds;			// Host time
+} TPokeMini_BatchJob;
+
+typedef struct {
+	int threads;			// Worker threads, 0 for one per core
+	int synccycles;			// Hardware sync cycles, 0 selects the event scheduler
+	int idleskip;			// Idle loop skipping mode
+} TPokeMini_BatchConfig;
+
+// Default configuration
+void PokeMini_BatchDefaults(TPokeMini_BatchConfig *config);
+
+// Run a single job on the calling thread
+int PokeMini_BatchRunJob(TPokeMini_BatchJob *job, const TPokeMini_BatchConfig *config);
+
+// Worker threads used to run 'num' jobs
+int PokeMini_BatchThreads(const TPokeMini_BatchConfig *config, int num);
+
+// Run all jobs across a work-stealing thread pool, return jobs done
+//   Each thread runs its own instance, the core must be built with
+//   POKEMINI_THREADS. Wall time is stored in 'seconds' when not NULL
+int PokeMini_BatchRun(TPokeMini_BatchJob *jobs, int num, const TPokeMini_BatchConfig *config, double *seconds);
+
+// Host clock in nanoseconds
+uint64_t PokeMini_BatchClock(void);
+
+#endif
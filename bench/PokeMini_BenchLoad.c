@@ -0,0 +1,53 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ROM loader for the headless benchmarks
+
+#include <stdio.h>
+
+// PokeMini headers
+#include "PokeMini.h"
+#include "PokeMini_BenchLoad.h"
+
+int PokeMini_BenchLoadMIN(const char *filename)
+{
+	FILE *fi;
+	long size;
+
+	fi = fopen(filename, "rb");
+	if (!fi) return 0;
+	fseek(fi, 0, SEEK_END);
+	size = ftell(fi);
+	fseek(fi, 0, SEEK_SET);
+	if ((size <= 0x2100) || (size > 0x200000)) {
+		fclose(fi);
+		return 0;
+	}
+	PokeMini_FreeColorInfo();
+	if (!PokeMini_NewMIN((uint32_t)size)) {
+		fclose(fi);
+		return 0;
+	}
+	if (fread(PM_ROM, 1, size, fi) != (size_t)size) {
+		fclose(fi);
+		return 0;
+	}
+	fclose(fi);
+	NewMulticart();
+	return 1;
+}
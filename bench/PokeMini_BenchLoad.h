@@ -0,0 +1,26 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_BENCHLOAD_H
+#define POKEMINI_BENCHLOAD_H
+
+// Load a .min file into PM_ROM and set up the multicart, return 1 on success
+//   Shared by the headless tools, the frontends load through their own I/O
+int PokeMini_BenchLoadMIN(const char *filename);
+
+#endif
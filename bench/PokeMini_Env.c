@@ -0,0 +1,218 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Batched environments
+//
+// Each environment keeps its own instance context and ROM image. The
+// prepared state is a raw snapshot, resetting copies it back with no hard
+// reset and no BIOS boot.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// PokeMini headers
+#include "PokeMini.h"
+#include "Hardware.h"
+#include "StateHash.h"
+#include "PokeMini_Env.h"
+
+struct TPokeMini_Env {
+	TPokeMini_Context *ctx;
+	uint8_t *rom;			// ROM image
+	uint32_t romsize;
+	int lcdmode;
+	int synccycles;
+	TPokeMini_Snapshot *state;	// Prepared state
+	uint8_t statekeys;		// Action held on the prepared state
+	uint8_t keys;			// Action being held
+	uint64_t cycles;		// Cycles since reset
+};
+
+static const uint8_t PokeMini_EnvKeys[8] = {
+	MINX_KEY_A, MINX_KEY_B, MINX_KEY_C, MINX_KEY_UP,
+	MINX_KEY_DOWN, MINX_KEY_LEFT, MINX_KEY_RIGHT, MINX_KEY_POWER
+};
+
+// Select environment instance
+static int PokeMini_EnvSelect(TPokeMini_Env *env)
+{
+	return PokeMini_SelectContext(env->ctx);
+}
+
+// Create the instance of a new environment, ROM must be set
+static int PokeMini_EnvStart(TPokeMini_Env *env)
+{
+	env->ctx = PokeMini_NewContext();
+	env->state = (TPokeMini_Snapshot *)malloc(sizeof(TPokeMini_Snapshot));
+	if (!env->ctx || !env->state) return 0;
+	if (!PokeMini_EnvSelect(env)) return 0;
+
+	CommandLineInit();
+	CommandLine.updatertc = 0;	// Keep runs deterministic
+	CommandLine.lcdmode = env->lcdmode;
+	CommandLine.synccycles = env->synccycles;
+	if (!PokeMini_Create(0, 4096)) return 0;
+	PokeMini_ApplyChanges();
+	MinxAudio_ChangeEngine(MINX_AUDIO_DISABLED);
+	if (!PokeMini_NewMIN(env->romsize)) return 0;
+	memcpy(PM_ROM, env->rom, env->romsize);
+	NewMulticart();
+	MinxIO_FormatEEPROM();
+	PokeMini_Reset(1);
+	return 1;
+}
+
+TPokeMini_Env *PokeMini_EnvCreate(const char *romfile, int lcdmode, int synccycles, int bootframes)
+{
+	TPokeMini_Context *prev = PokeMini_GetContext();
+	TPokeMini_Env *env;
+	FILE *fi;
+	long size;
+	int i;
+
+	env = (TPokeMini_Env *)calloc(1, sizeof(TPokeMini_Env));
+	if (!env) return NULL;
+	env->lcdmode = lcdmode;
+	env->synccycles = synccycles;
+
+	// Load ROM image
+	fi = fopen(romfile, "rb");
+	if (!fi) {
+		free(env);
+		return NULL;
+	}
+	fseek(fi, 0, SEEK_END);
+	size = ftell(fi);
+	fseek(fi, 0, SEEK_SET);
+	if ((size > 0x2100) && (size <= 0x200000)) {
+		env->rom = (uint8_t *)malloc(size);
+		if (env->rom && (fread(env->rom, 1, size, fi) == (size_t)size)) env->romsize = (uint32_t)size;
+	}
+	fclose(fi);
+
+	if (!env->romsize || !PokeMini_EnvStart(env)) {
+		PokeMini_SelectContext(prev);
+		PokeMini_EnvDestroy(env);
+		return NULL;
+	}
+	for (i=0; i<bootframes; i++) PokeMini_EmulateFrame();
+	PokeMini_SaveSnapshot(env->state);
+	PokeMini_SelectContext(prev);
+	return env;
+}
+
+TPokeMini_Env *PokeMini_EnvClone(TPokeMini_Env *env)
+{
+	TPokeMini_Context *prev = PokeMini_GetContext();
+	TPokeMini_Env *clone;
+
+	clone = (TPokeMini_Env *)calloc(1, sizeof(TPokeMini_Env));
+	if (!clone) return NULL;
+	clone->lcdmode = env->lcdmode;
+	clone->synccycles = env->synccycles;
+	clone->rom = (uint8_t *)malloc(env->romsize);
+	if (clone->rom) {
+		memcpy(clone->rom, env->rom, env->romsize);
+		clone->romsize = env->romsize;
+	}
+	if (!clone->romsize || !PokeMini_EnvStart(clone)) {
+		PokeMini_SelectContext(prev);
+		PokeMini_EnvDestroy(clone);
+		return NULL;
+	}
+	memcpy(clone->state, env->state, sizeof(TPokeMini_Snapshot));
+	clone->statekeys = env->statekeys;
+	PokeMini_SelectContext(prev);
+	if (!PokeMini_EnvReset(clone)) {
+		PokeMini_EnvDestroy(clone);
+		return NULL;
+	}
+	return clone;
+}
+
+void PokeMini_EnvDestroy(TPokeMini_Env *env)
+{
+	TPokeMini_Context *prev = PokeMini_GetContext();
+
+	if (!env) return;
+	if (env->ctx) {
+		if (PokeMini_EnvSelect(env)) PokeMini_Destroy();
+		PokeMini_SelectContext((prev == env->ctx) ? NULL : prev);
+		PokeMini_FreeContext(env->ctx);
+	}
+	free(env->state);
+	free(env->rom);
+	free(env);
+}
+
+int PokeMini_EnvPrepare(TPokeMini_Env *env)
+{
+	if (!PokeMini_EnvSelect(env)) return 0;
+	PokeMini_SaveSnapshot(env->state);
+	env->statekeys = env->keys;
+	return 1;
+}
+
+int PokeMini_EnvReset(TPokeMini_Env *env)
+{
+	if (!PokeMini_EnvSelect(env)) return 0;
+	if (!PokeMini_LoadSnapshot(env->state)) return 0;
+
+	// Key pad state is part of the I/O registers
+	env->keys = env->statekeys;
+	env->cycles = 0;
+	return 1;
+}
+
+int PokeMini_EnvStep(TPokeMini_Env **envs, const uint8_t *actions, int num, int frames, uint8_t *pixels, int source)
+{
+	TPokeMini_Env *env;
+	uint8_t changed;
+	int i, j;
+
+	for (i=0; i<num; i++) {
+		env = envs[i];
+		if (!PokeMini_EnvSelect(env)) return i;
+
+		// Press and release keys that changed
+		changed = env->keys ^ actions[i];
+		env->keys = actions[i];
+		for (j=0; j<8; j++) {
+			if (changed & (1 << j)) MinxIO_Keypad(PokeMini_EnvKeys[j], (env->keys >> j) & 1);
+		}
+
+		for (j=0; j<frames; j++) env->cycles += PokeMini_EmulateFrame();
+
+		if (pixels) {
+			memcpy(pixels + i * POKEMINI_ENV_PIXELS, (source == POKEMINI_ENV_ANALOG) ? LCDPixelsA : LCDPixelsD, POKEMINI_ENV_PIXELS);
+		}
+	}
+	return num;
+}
+
+uint64_t PokeMini_EnvCycles(TPokeMini_Env *env)
+{
+	return env->cycles;
+}
+
+uint64_t PokeMini_EnvHash(TPokeMini_Env *env)
+{
+	if (!PokeMini_EnvSelect(env)) return 0;
+	return PokeMini_StateHash(NULL);
+}
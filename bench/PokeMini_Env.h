@@ -0,0 +1,82 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_ENV_H
+#define POKEMINI_ENV_H
+
+#include <stdint.h>
+
+// Batched environments for training loops
+//   Every environment is an emulator instance. Stepping runs the core only,
+//   the raw LCD pixels are copied out without palette, scaling or audio.
+//   Instances share the core globals and are swapped in turn, so all calls
+//   must come from the same thread
+typedef struct TPokeMini_Env TPokeMini_Env;
+
+// Action bits, one per key
+enum {
+	POKEMINI_ENV_A = 0x01,
+	POKEMINI_ENV_B = 0x02,
+	POKEMINI_ENV_C = 0x04,
+	POKEMINI_ENV_UP = 0x08,
+	POKEMINI_ENV_DOWN = 0x10,
+	POKEMINI_ENV_LEFT = 0x20,
+	POKEMINI_ENV_RIGHT = 0x40,
+	POKEMINI_ENV_POWER = 0x80
+};
+
+// Pixels returned by PokeMini_EnvStep, one byte each
+enum {
+	POKEMINI_ENV_DIGITAL = 0,	// LCDPixelsD, 0 or 1 per pixel
+	POKEMINI_ENV_ANALOG = 1		// LCDPixelsA, 0 to 255 per pixel (analog or 3 shades LCD mode)
+};
+
+#define POKEMINI_ENV_WIDTH	96
+#define POKEMINI_ENV_HEIGHT	64
+#define POKEMINI_ENV_PIXELS	(POKEMINI_ENV_WIDTH * POKEMINI_ENV_HEIGHT)
+
+// Create an environment from a ROM, run 'bootframes' from a hard reset
+// with no input and keep that as the prepared state
+//   lcdmode is one of LCDMODE_*, synccycles 0 selects the event scheduler
+TPokeMini_Env *PokeMini_EnvCreate(const char *romfile, int lcdmode, int synccycles, int bootframes);
+
+// New environment with the same ROM and prepared state, at that state
+TPokeMini_Env *PokeMini_EnvClone(TPokeMini_Env *env);
+
+// Destroy environment
+void PokeMini_EnvDestroy(TPokeMini_Env *env);
+
+// Keep the current state as the prepared one
+int PokeMini_EnvPrepare(TPokeMini_Env *env);
+
+// Go back to the prepared state
+int PokeMini_EnvReset(TPokeMini_Env *env);
+
+// Step 'num' environments in lockstep
+//   Each holds actions[i] for 'frames' frames, then its pixels are written
+//   to 'pixels' + i * POKEMINI_ENV_PIXELS. Pixels can be NULL
+//   Return number of environments stepped
+int PokeMini_EnvStep(TPokeMini_Env **envs, const uint8_t *actions, int num, int frames, uint8_t *pixels, int source);
+
+// Cycles emulated by the environment since it was last reset
+uint64_t PokeMini_EnvCycles(TPokeMini_Env *env);
+
+// Hash of the environment state, see PokeMini_StateHash()
+uint64_t PokeMini_EnvHash(TPokeMini_Env *env);
+
+#endif
@@ -0,0 +1,144 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ALU benchmark
+//
+// Checks that the branch-free instructions macros from MinxCPU_noBranch.h
+// leave the same CPU state as the ones in MinxCPU.h, for every operand and
+// flag register value (all flag modes, carry in and untouched bits), then
+// times both. Output is one "key=value" line per instruction.
+//
+// Usage: alubench [-n iterations] [-f flags]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "alubench.h"
+
+TMinxCPU MinxCPU;
+
+#define ALUBENCH_OP(name, bits, args) { #name, bits, args },
+static const struct {
+	const char *name;
+	int bits, args;
+} ALUBench_Info[ALUBENCH_NUMOPS] = {
+	ALUBENCH_OPS
+};
+#undef ALUBENCH_OP
+
+// 16-bits operands: edge cases plus pseudo-random values
+#define ALUBENCH_NUMVAL16 64
+static uint16_t ALUBench_Val16[ALUBENCH_NUMVAL16];
+
+static void ALUBench_InitValues(void)
+{
+	static const uint16_t edge[16] = {
+		0x0000, 0x0001, 0x0002, 0x0009, 0x000F, 0x0010, 0x007F, 0x0080,
+		0x00FF, 0x0100, 0x7FFF, 0x8000, 0x8001, 0xFF00, 0xFFFE, 0xFFFF
+	};
+	uint32_t seed = 0xC0FFEE;
+	int i;
+
+	for (i=0; i<ALUBENCH_NUMVAL16; i++) {
+		seed = seed * 1103515245 + 12345;
+		ALUBench_Val16[i] = (i < 16) ? edge[i] : (uint16_t)(seed >> 8);
+	}
+}
+
+// Compare both builds for one instruction, return number of mismatches
+static uint32_t ALUBench_Check(int op)
+{
+	TMinxCPU base, cpu1, cpu2;
+	uint32_t a, b, f, bcount, fstep, mismatches = 0;
+	uint16_t res1, res2, bval;
+
+	// Registers not under test hold a fixed pattern
+	memset(&base, 0, sizeof(TMinxCPU));
+	base.BA.W.L = 0x1234;
+	base.HL.W.L = 0x5678;
+	base.X.W.L = 0x9ABC;
+	base.Y.W.L = 0xDEF0;
+	base.SP.W.L = 0x1FFE;
+
+	// 8-bits: all operands with all flags, 16-bits: all A against a set of B
+	bcount = (ALUBench_Info[op].args == 1) ? 1 : (ALUBench_Info[op].bits == 8 ? 256 : ALUBENCH_NUMVAL16);
+	fstep = (ALUBench_Info[op].bits == 8) ? 1 : 0x11;
+	for (f=0; f<256; f+=fstep) {
+		for (b=0; b<bcount; b++) {
+			bval = (ALUBench_Info[op].bits == 8) ? (uint16_t)b : ALUBench_Val16[b];
+			if (op == ALUBENCH_MUL || op == ALUBENCH_DIV) bval = (uint16_t)b;
+			for (a=0; a<(ALUBench_Info[op].bits == 8 ? 256u : 65536u); a++) {
+				base.F = (uint8_t)f;
+				memcpy(&cpu1, &base, sizeof(TMinxCPU));
+				memcpy(&cpu2, &base, sizeof(TMinxCPU));
+				res1 = ALUBench_ExecBranch(op, &cpu1, (uint16_t)a, bval);
+				res2 = ALUBench_ExecNoBranch(op, &cpu2, (uint16_t)a, bval);
+				if ((res1 != res2) || memcmp(&cpu1, &cpu2, sizeof(TMinxCPU))) {
+					if (!mismatches) {
+						fprintf(stderr, "%s: A=%04X B=%04X F=%02X, result %04X/%04X, flags %02X/%02X\n",
+							ALUBench_Info[op].name, a, bval, f, res1, res2, cpu1.F, cpu2.F);
+					}
+					mismatches++;
+				}
+			}
+		}
+	}
+	return mismatches;
+}
+
+static double ALUBench_Time(TALUBench_Loop *loop, int op, uint32_t count, uint8_t flags, uint32_t *sum)
+{
+	clock_t start = clock();
+	*sum = loop(op, count, flags);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t iterations = 20000000, mismatches, total = 0;
+	uint32_t sum1, sum2;
+	double t1, t2;
+	int flags = 0x00;
+	int i;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-n") && (i+1 < argc)) iterations = (uint32_t)atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && (i+1 < argc)) flags = (int)strtol(argv[++i], NULL, 0);
+		else {
+			fprintf(stderr, "Usage: %s [-n iterations] [-f flags]\n", argv[0]);
+			return 1;
+		}
+	}
+	ALUBench_InitValues();
+
+	printf("iterations=%u flags=0x%02X\n", iterations, flags & 0x30);
+	for (i=0; i<ALUBENCH_NUMOPS; i++) {
+		mismatches = ALUBench_Check(i);
+		t1 = ALUBench_Time(ALUBench_LoopBranch, i, iterations, (uint8_t)(flags & 0x30), &sum1);
+		t2 = ALUBench_Time(ALUBench_LoopNoBranch, i, iterations, (uint8_t)(flags & 0x30), &sum2);
+		if (sum1 != sum2) mismatches++;
+		total += mismatches;
+		printf("op=%s mismatches=%u branch=%.6f nobranch=%.6f speedup=%.3f\n",
+			ALUBench_Info[i].name, mismatches, t1, t2,
+			t2 > 0.0 ? t1 / t2 : 0.0);
+	}
+	printf("match=%i\n", total == 0);
+	return total ? 2 : 0;
+}
@@ -0,0 +1,61 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ALU benchmark, shared between the two ALU builds
+
+#ifndef ALUBENCH_H
+#define ALUBENCH_H
+
+#include <stdint.h>
+#include "MinxCPU.h"
+
+// Instructions macros under test, A/B are the operands
+// (MUL and DIV use A as HL and B as BA low byte)
+#define ALUBENCH_OPS \
+	ALUBENCH_OP(ADD8,  8, 2) ALUBENCH_OP(ADD16, 16, 2) \
+	ALUBENCH_OP(ADC8,  8, 2) ALUBENCH_OP(ADC16, 16, 2) \
+	ALUBENCH_OP(SUB8,  8, 2) ALUBENCH_OP(SUB16, 16, 2) \
+	ALUBENCH_OP(SBC8,  8, 2) ALUBENCH_OP(SBC16, 16, 2) \
+	ALUBENCH_OP(AND8,  8, 2) ALUBENCH_OP(OR8,   8, 2) \
+	ALUBENCH_OP(XOR8,  8, 2) ALUBENCH_OP(INC8,  8, 1) \
+	ALUBENCH_OP(INC16, 16, 1) ALUBENCH_OP(DEC8,  8, 1) \
+	ALUBENCH_OP(DEC16, 16, 1) ALUBENCH_OP(SAL,   8, 1) \
+	ALUBENCH_OP(SHL,   8, 1) ALUBENCH_OP(SAR,   8, 1) \
+	ALUBENCH_OP(SHR,   8, 1) ALUBENCH_OP(ROLC,  8, 1) \
+	ALUBENCH_OP(ROL,   8, 1) ALUBENCH_OP(RORC,  8, 1) \
+	ALUBENCH_OP(ROR,   8, 1) ALUBENCH_OP(NOT,   8, 1) \
+	ALUBENCH_OP(NEG,   8, 1) ALUBENCH_OP(MUL,  16, 2) \
+	ALUBENCH_OP(DIV,  16, 2)
+
+#define ALUBENCH_OP(name, bits, args) ALUBENCH_##name,
+enum {
+	ALUBENCH_OPS
+	ALUBENCH_NUMOPS
+};
+#undef ALUBENCH_OP
+
+// Run one instruction over a CPU state, return the result
+typedef uint16_t TALUBench_Exec(int op, TMinxCPU *cpu, uint16_t a, uint16_t b);
+
+// Run an instruction count times over pseudo-random operands, returns a checksum
+typedef uint32_t TALUBench_Loop(int op, uint32_t count, uint8_t flags);
+
+TALUBench_Exec ALUBench_ExecBranch, ALUBench_ExecNoBranch;
+TALUBench_Loop ALUBench_LoopBranch, ALUBench_LoopNoBranch;
+
+#endif
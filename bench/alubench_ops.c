@@ -0,0 +1,93 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// ALU benchmark, instructions macros wrapper
+//
+// Built twice by the alubench target, once with the default ALU and once
+// with MINX_NOBRANCH, ALUBENCH_SUFFIX names each copy
+
+#include <string.h>
+
+#include "alubench.h"
+
+#define ALUBENCH_NAME2(name, suffix) name##suffix
+#define ALUBENCH_NAME(name, suffix) ALUBENCH_NAME2(name, suffix)
+
+static INLINE uint16_t ALUBench_Op(int op, uint16_t a, uint16_t b)
+{
+	switch (op) {
+		case ALUBENCH_ADD8:  return ADD8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_ADD16: return ADD16(a, b);
+		case ALUBENCH_ADC8:  return ADC8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_ADC16: return ADC16(a, b);
+		case ALUBENCH_SUB8:  return SUB8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_SUB16: return SUB16(a, b);
+		case ALUBENCH_SBC8:  return SBC8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_SBC16: return SBC16(a, b);
+		case ALUBENCH_AND8:  return AND8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_OR8:   return OR8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_XOR8:  return XOR8((uint8_t)a, (uint8_t)b);
+		case ALUBENCH_INC8:  return INC8((uint8_t)a);
+		case ALUBENCH_INC16: return INC16(a);
+		case ALUBENCH_DEC8:  return DEC8((uint8_t)a);
+		case ALUBENCH_DEC16: return DEC16(a);
+		case ALUBENCH_SAL:   return SAL((uint8_t)a);
+		case ALUBENCH_SHL:   return SHL((uint8_t)a);
+		case ALUBENCH_SAR:   return SAR((uint8_t)a);
+		case ALUBENCH_SHR:   return SHR((uint8_t)a);
+		case ALUBENCH_ROLC:  return ROLC((uint8_t)a);
+		case ALUBENCH_ROL:   return ROL((uint8_t)a);
+		case ALUBENCH_RORC:  return RORC((uint8_t)a);
+		case ALUBENCH_ROR:   return ROR((uint8_t)a);
+		case ALUBENCH_NOT:   return NOT((uint8_t)a);
+		case ALUBENCH_NEG:   return NEG((uint8_t)a);
+		case ALUBENCH_MUL:
+			MinxCPU.HL.W.L = a;
+			MinxCPU.BA.B.L = (uint8_t)b;
+			MUL();
+			return MinxCPU.HL.W.L;
+		case ALUBENCH_DIV:
+			MinxCPU.HL.W.L = a;
+			MinxCPU.BA.B.L = (uint8_t)b;
+			DIV();
+			return MinxCPU.HL.W.L;
+	}
+	return 0;
+}
+
+uint16_t ALUBENCH_NAME(ALUBench_Exec, ALUBENCH_SUFFIX)(int op, TMinxCPU *cpu, uint16_t a, uint16_t b)
+{
+	uint16_t res;
+	memcpy(&MinxCPU, cpu, sizeof(TMinxCPU));
+	res = ALUBench_Op(op, a, b);
+	memcpy(cpu, &MinxCPU, sizeof(TMinxCPU));
+	return res;
+}
+
+uint32_t ALUBENCH_NAME(ALUBench_Loop, ALUBENCH_SUFFIX)(int op, uint32_t count, uint8_t flags)
+{
+	uint32_t seed = 0x12345678, sum = 0;
+	MinxCPU.F = flags;
+	while (count--) {
+		seed = seed * 1103515245 + 12345;
+		sum += ALUBench_Op(op, (uint16_t)(seed >> 16), (uint16_t)seed);
+		sum += MinxCPU.F;
+		MinxCPU.F = (MinxCPU.F & 0xCF) | flags;
+	}
+	return sum;
+}
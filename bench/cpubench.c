@@ -0,0 +1,123 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// CPU dispatch benchmark
+//
+// Runs the same ROM from a hard reset with the switch interpreter and,
+// when available, with threaded dispatch, then reports instructions per
+// second for each one. Output is one "key=value" line per variant.
+//
+// Usage: cpubench [-f frames] [-s synccycles] rom.min
+// synccycles 0 selects the event driven scheduler
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// PokeMini headers
+#include "PokeMini.h"
+#include "Hardware.h"
+#include "PokeMini_BenchLoad.h"
+
+typedef struct {
+	uint32_t instructions;
+	uint64_t cycles;
+	double seconds;
+	TMinxCPU cpu;
+	uint8_t ram[8192];
+} TCPUBench_Result;
+
+static void CPUBench_Run(int frames, TCPUBench_Result *res)
+{
+	uint32_t executed;
+	clock_t start;
+	int i;
+
+	MinxIO_FormatEEPROM();
+	PokeMini_Reset(1);
+
+	res->cycles = 0;
+	executed = MinxCPU_Executed;
+	start = clock();
+	for (i=0; i<frames; i++) res->cycles += PokeMini_EmulateFrame();
+	res->seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	res->instructions = MinxCPU_Executed - executed;
+	memcpy(&res->cpu, &MinxCPU, sizeof(TMinxCPU));
+	memcpy(res->ram, PM_RAM, 8192);
+}
+
+static void CPUBench_Report(const char *dispatch, TCPUBench_Result *res)
+{
+	double secs = res->seconds > 0.0 ? res->seconds : 1e-9;
+	printf("dispatch=%s instructions=%u cycles=%llu seconds=%.6f ips=%.0f\n",
+		dispatch, res->instructions, (unsigned long long)res->cycles,
+		res->seconds, (double)res->instructions / secs);
+}
+
+int main(int argc, char **argv)
+{
+	static TCPUBench_Result sw, th;
+	const char *romfile = NULL;
+	int frames = 3600;
+	int synccycles = 8;
+	int i;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-f") && (i+1 < argc)) frames = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-s") && (i+1 < argc)) synccycles = atoi(argv[++i]);
+		else romfile = argv[i];
+	}
+	if (!romfile || (frames <= 0) || (synccycles < 0)) {
+		fprintf(stderr, "Usage: %s [-f frames] [-s synccycles] rom.min\n", argv[0]);
+		return 1;
+	}
+
+	CommandLineInit();
+	CommandLine.updatertc = 0;	// Keep runs deterministic
+	CommandLine.synccycles = synccycles;
+	if (!PokeMini_Create(0, 4096)) {
+		fprintf(stderr, "Error creating emulator\n");
+		return 1;
+	}
+	MinxAudio_ChangeEngine(MINX_AUDIO_GENERATED);
+	if (!PokeMini_BenchLoadMIN(romfile)) {
+		fprintf(stderr, "Error loading ROM '%s'\n", romfile);
+		PokeMini_Destroy();
+		return 1;
+	}
+
+	printf("rom=%s frames=%i synccycles=%i\n", romfile, frames, synccycles);
+#ifdef MINX_THREADED
+	MinxCPU_Threaded = 0;
+#endif
+	CPUBench_Run(frames, &sw);
+	CPUBench_Report("switch", &sw);
+#ifdef MINX_THREADED
+	MinxCPU_Threaded = 1;
+	MinxCPU_ThreadedMin = 0;
+	CPUBench_Run(frames, &th);
+	CPUBench_Report("threaded", &th);
+	printf("match=%i speedup=%.3f\n",
+		!memcmp(&sw.cpu, &th.cpu, sizeof(TMinxCPU)) && !memcmp(sw.ram, th.ram, 8192),
+		th.seconds > 0.0 ? sw.seconds / th.seconds : 0.0);
+#endif
+
+	PokeMini_Destroy();
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Batched environment benchmark
+//
+// Clones environments from one prepared state and steps them in lockstep
+// with pseudo-random actions, then reports steps per second. Each
+// environment gets its own actions, at the end every one is reset and
+// replayed alone and must end on the same pixels and state hash. This
+// checks the reset and catches instance state left out of
+// PokeMini_SwapContext(), which leaks between environments stepped together.
+//
+// Usage: envbench [options] rom.min
+//   -n envs         Environments (default 16)
+//   -k steps        Steps (default 1000)
+//   -f frames       Frames per step (default 4)
+//   -b bootframes   Frames ran before the prepared state (default 300)
+//   -r resets       Steps between resets, 0 never resets (default 100)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "PokeMini.h"
+#include "PokeMini_Env.h"
+
+static uint64_t EnvBench_Clock(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+	return (uint64_t)clock() * (1000000000ULL / CLOCKS_PER_SEC);
+#endif
+}
+
+// Same sequence every run, different for each environment
+static uint8_t EnvBench_Action(int env, int step)
+{
+	uint32_t x = ((uint32_t)step + (uint32_t)env * 7919u) * 2654435761u;
+	return (uint8_t)((x >> 13) & 0x7F);	// No power key
+}
+
+int main(int argc, char **argv)
+{
+	const char *romfile = NULL;
+	int numenvs = 16, steps = 1000, frames = 4, bootframes = 300, resets = 100;
+	TPokeMini_Env **envs;
+	uint8_t *actions, *pixels, *replay;
+	uint64_t *hashes;
+	uint64_t start, total, cycles = 0;
+	int i, j, mismatch = 0, numresets = 0;
+	double secs;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-n") && (i+1 < argc)) numenvs = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-k") && (i+1 < argc)) steps = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-f") && (i+1 < argc)) frames = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-b") && (i+1 < argc)) bootframes = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-r") && (i+1 < argc)) resets = atoi(argv[++i]);
+		else romfile = argv[i];
+	}
+	if (!romfile || (numenvs <= 0) || (steps <= 0) || (frames <= 0) || (bootframes < 0) || (resets < 0)) {
+		fprintf(stderr, "Usage: %s [-n envs] [-k steps] [-f frames] [-b bootframes] [-r resets] rom.min\n", argv[0]);
+		return 1;
+	}
+
+	envs = (TPokeMini_Env **)calloc(numenvs, sizeof(TPokeMini_Env *));
+	actions = (uint8_t *)malloc(numenvs);
+	pixels = (uint8_t *)malloc(numenvs * POKEMINI_ENV_PIXELS);
+	replay = (uint8_t *)malloc(POKEMINI_ENV_PIXELS);
+	hashes = (uint64_t *)malloc(numenvs * sizeof(uint64_t));
+	if (!envs || !actions || !pixels || !replay || !hashes) return 1;
+	envs[0] = PokeMini_EnvCreate(romfile, LCDMODE_ANALOG, 0, bootframes);
+	if (!envs[0]) {
+		fprintf(stderr, "Error creating environment from '%s'\n", romfile);
+		return 1;
+	}
+	for (i=1; i<numenvs; i++) {
+		envs[i] = PokeMini_EnvClone(envs[0]);
+		if (!envs[i]) {
+			fprintf(stderr, "Error cloning environment\n");
+			return 1;
+		}
+	}
+
+	start = EnvBench_Clock();
+	for (i=0; i<steps; i++) {
+		if (resets && i && !(i % resets)) {
+			for (j=0; j<numenvs; j++) {
+				cycles += PokeMini_EnvCycles(envs[j]);
+				PokeMini_EnvReset(envs[j]);
+			}
+			numresets++;
+		}
+		for (j=0; j<numenvs; j++) actions[j] = EnvBench_Action(j, resets ? i % resets : i);
+		PokeMini_EnvStep(envs, actions, numenvs, frames, pixels, POKEMINI_ENV_ANALOG);
+	}
+	total = EnvBench_Clock() - start;
+	for (j=0; j<numenvs; j++) {
+		cycles += PokeMini_EnvCycles(envs[j]);
+		hashes[j] = PokeMini_EnvHash(envs[j]);
+	}
+
+	// Replay the last stretch on each environment alone
+	for (j=0; j<numenvs; j++) {
+		PokeMini_EnvReset(envs[j]);
+		for (i=resets ? ((steps - 1) / resets) * resets : 0; i<steps; i++) {
+			actions[0] = EnvBench_Action(j, resets ? i % resets : i);
+			PokeMini_EnvStep(envs + j, actions, 1, frames, replay, POKEMINI_ENV_ANALOG);
+		}
+		if (memcmp(pixels + j * POKEMINI_ENV_PIXELS, replay, POKEMINI_ENV_PIXELS) ||
+		    (hashes[j] != PokeMini_EnvHash(envs[j]))) mismatch++;
+	}
+
+	secs = total > 0 ? (double)total / 1e9 : 1e-9;
+	printf("rom=%s\n", romfile);
+	printf("envs=%i\n", numenvs);
+	printf("steps=%i\n", steps);
+	printf("frames_per_step=%i\n", frames);
+	printf("resets=%i\n", numresets);
+	printf("mismatches=%i\n", mismatch);
+	printf("seconds=%.6f\n", secs);
+	printf("env_steps_per_sec=%.2f\n", (double)steps * numenvs / secs);
+	printf("fps=%.2f\n", (double)steps * numenvs * frames / secs);
+	printf("cps=%.0f\n", (double)cycles / secs);
+
+	for (i=0; i<numenvs; i++) PokeMini_EnvDestroy(envs[i]);
+	free(hashes);
+	free(replay);
+	free(pixels);
+	free(actions);
+	free(envs);
+	return mismatch ? 1 : 0;
+}
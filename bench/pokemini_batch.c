@@ -0,0 +1,165 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Multi-threaded batch runner
+//
+// Runs many emulator instances from a hard reset across a thread pool and
+// reports the final state hashes of each one, plus aggregate frames per
+// second. Output is one "key=value" pair per line, jobs are prefixed with
+// their index as "jobN.key=value".
+//
+// Usage: pokemini_batch [options] [rom.min ...]
+//   -l jobs.txt     Job list, one "rom frames [input] [screenshot]" per line,
+//                   "-" skips the input
+//   -f frames       Frames for ROMs given on the command line (default 3600)
+//   -n copies       Jobs for each ROM given on the command line (default 1)
+//   -t threads      Worker threads, 0 for one per core (default 0)
+//   -s synccycles   Hardware sync cycles, 0 selects the event scheduler
+//   -i idleskip     Idle loop skipping, 0=off, 1=auto
+//   -q              Only print the aggregate results
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PokeMini_Batch.h"
+
+typedef struct {
+	TPokeMini_BatchJob *jobs;
+	int num, max;
+} TPokeMiniBatch_List;
+
+// Strings are kept for the whole run
+static char *PokeMiniBatch_StrDup(const char *str)
+{
+	char *dup = (char *)malloc(strlen(str) + 1);
+	if (dup) strcpy(dup, str);
+	return dup;
+}
+
+static TPokeMini_BatchJob *PokeMiniBatch_AddJob(TPokeMiniBatch_List *list)
+{
+	TPokeMini_BatchJob *jobs;
+
+	if (list->num >= list->max) {
+		list->max = list->max ? list->max * 2 : 64;
+		jobs = (TPokeMini_BatchJob *)realloc(list->jobs, list->max * sizeof(TPokeMini_BatchJob));
+		if (!jobs) return NULL;
+		list->jobs = jobs;
+	}
+	jobs = &list->jobs[list->num++];
+	memset(jobs, 0, sizeof(TPokeMini_BatchJob));
+	return jobs;
+}
+
+static int PokeMiniBatch_LoadList(TPokeMiniBatch_List *list, const char *filename)
+{
+	FILE *fi;
+	char line[1024], rom[1024], input[1024], shot[1024];
+	TPokeMini_BatchJob *job;
+	int frames, fields;
+
+	fi = fopen(filename, "r");
+	if (!fi) return 0;
+	while (fgets(line, sizeof(line), fi)) {
+		if ((line[0] == ';') || (line[0] == '#')) continue;
+		fields = sscanf(line, "%1023s %i %1023s %1023s", rom, &frames, input, shot);
+		if (fields < 2) continue;
+		job = PokeMiniBatch_AddJob(list);
+		if (!job) break;
+		job->rom = PokeMiniBatch_StrDup(rom);
+		job->frames = frames;
+		if ((fields >= 3) && strcmp(input, "-")) job->input = PokeMiniBatch_StrDup(input);
+		if ((fields >= 4) && strcmp(shot, "-")) job->screenshot = PokeMiniBatch_StrDup(shot);
+	}
+	fclose(fi);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	TPokeMini_BatchConfig config;
+	TPokeMiniBatch_List list;
+	TPokeMini_BatchJob *job;
+	int frames = 3600, copies = 1, quiet = 0;
+	int i, j, done, threads;
+	uint64_t totalframes = 0, cycles = 0;
+	double secs = 0.0, jobsecs = 0.0;
+
+	memset(&list, 0, sizeof(list));
+	PokeMini_BatchDefaults(&config);
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-f") && (i+1 < argc)) frames = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && (i+1 < argc)) copies = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-t") && (i+1 < argc)) config.threads = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-s") && (i+1 < argc)) config.synccycles = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-i") && (i+1 < argc)) config.idleskip = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-q")) quiet = 1;
+		else if (!strcmp(argv[i], "-l") && (i+1 < argc)) {
+			if (!PokeMiniBatch_LoadList(&list, argv[++i])) {
+				fprintf(stderr, "Error loading job list '%s'\n", argv[i]);
+				return 1;
+			}
+		} else {
+			for (j=0; j<copies; j++) {
+				job = PokeMiniBatch_AddJob(&list);
+				if (!job) break;
+				job->rom = argv[i];
+				job->frames = frames;
+			}
+		}
+	}
+	if (!list.num || (frames <= 0) || (copies <= 0) || (config.threads < 0) || (config.synccycles < 0) || (config.idleskip < 0) || (config.idleskip > 1)) {
+		fprintf(stderr, "Usage: %s [-l jobs.txt] [-f frames] [-n copies] [-t threads] [-s synccycles] [-i idleskip] [-q] [rom.min ...]\n", argv[0]);
+		return 1;
+	}
+
+	done = PokeMini_BatchRun(list.jobs, list.num, &config, &secs);
+
+	for (i=0; i<list.num; i++) {
+		job = &list.jobs[i];
+		if (job->status > 0) {
+			totalframes += job->frames;
+			cycles += job->cycles;
+			jobsecs += job->seconds;
+		}
+		if (quiet) continue;
+		printf("job%i.rom=%s\n", i, job->rom);
+		printf("job%i.status=%s\n", i, job->status > 0 ? "ok" : "failed");
+		if (job->status <= 0) continue;
+		printf("job%i.frames=%i\n", i, job->frames);
+		printf("job%i.cycles=%llu\n", i, (unsigned long long)job->cycles);
+		printf("job%i.hash_cpu=%016llx\n", i, (unsigned long long)job->hash_cpu);
+		printf("job%i.hash_ram=%016llx\n", i, (unsigned long long)job->hash_ram);
+		printf("job%i.hash_lcd=%016llx\n", i, (unsigned long long)job->hash_lcd);
+		printf("job%i.hash_eeprom=%016llx\n", i, (unsigned long long)job->hash_eeprom);
+		printf("job%i.seconds=%.6f\n", i, job->seconds);
+	}
+	threads = PokeMini_BatchThreads(&config, list.num);
+	if (secs <= 0.0) secs = 1e-9;
+	printf("jobs=%i\n", list.num);
+	printf("done=%i\n", done);
+	printf("threads=%i\n", threads);
+	printf("frames=%llu\n", (unsigned long long)totalframes);
+	printf("cycles=%llu\n", (unsigned long long)cycles);
+	printf("seconds=%.6f\n", secs);
+	printf("fps=%.2f\n", (double)totalframes / secs);
+	printf("fps_per_job=%.2f\n", jobsecs > 0.0 ? (double)totalframes / jobsecs : 0.0);
+
+	return (done == list.num) ? 0 : 1;
+}
@@ -0,0 +1,372 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Headless emulation benchmark
+//
+// Runs a ROM from a hard reset for a number of frames without the libretro
+// frontend, optionally with the video blit and audio output stages that a
+// frontend performs every frame, then reports frames per second, emulated
+// cycles per second and host time per stage. Output is one "key=value"
+// pair per line so it can be tracked by scripts.
+//
+// Usage: pokemini_bench [options] rom.min
+//   -f frames       Frames to emulate (default 3600)
+//   -s synccycles   Hardware sync cycles, 0 selects the event scheduler
+//   -e engine       Audio engine, 0=disabled, 1=generated, 2=direct PWM
+//   -b scale        Blit each frame to a buffer at scale 1 to 7
+//   -d depth        Blit depth, 16 for RGB565 or 32 for XRGB8888
+//   -c              Convert each 16bpp frame to XRGB8888 after the blit,
+//                   like a frontend that can't take RGB565 has to
+//   -a              Read each frame audio samples, stereo 44100Hz
+//   -P              Don't time the stages, only the whole run
+//   -S              Time snapshot and compact savestate save and restore
+//                   on the final state
+//   -R bytes        Push each frame into a rewind buffer of this size
+//   -A frames       Run ahead this many frames each frame, then restore
+//   -H              Render run-ahead frames instead of hiding them
+//   -K              Hash the state each frame
+//
+// Stages are cpu, timers, prc, lcd, blit and audio, time spent in one
+// stage running inside another only counts for the inner one. Anything
+// else the frame does (PRC sync, IRQs, audio sync) is reported as other.
+// With -b the host time from blit to a frame ready in the frontend's
+// format, including any conversion, is reported as output_ns.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// PokeMini headers
+#include "PokeMini.h"
+#include "Hardware.h"
+#include "Rewind.h"
+#include "StateHash.h"
+#include "Video_Scale.h"
+#include "PokeMini_BenchLoad.h"
+
+// Audio samples per 72Hz frame at 44100Hz, alternating
+static const int PokeMiniBench_SamplesPerFrame[2] = { 612, 613 };
+
+static const char *PokeMiniBench_StageName[POKEMINI_PROF_STAGES] = {
+	"cpu", "timers", "prc", "lcd", "blit", "audio"
+};
+
+static TMinxPRC_Render PokeMiniBench_PRCRender;
+
+// Host clock in nanoseconds
+static uint64_t PokeMiniBench_Clock(void)
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#else
+	return (uint64_t)clock() * (1000000000ULL / CLOCKS_PER_SEC);
+#endif
+}
+
+// Time the PRC renderer selected by the LCD mode
+static void PokeMiniBench_Render(void)
+{
+	PokeMini_ProfEnter(POKEMINI_PROF_PRC);
+	PokeMiniBench_PRCRender();
+	PokeMini_ProfLeave();
+}
+
+static int PokeMiniBench_SetVideo(int scale, int depth)
+{
+	static const TPokeMini_VideoSpec *specs[7] = {
+		&PokeMini_Video1x1, &PokeMini_Video2x2, &PokeMini_Video3x3,
+		&PokeMini_Video4x4, &PokeMini_Video5x5, &PokeMini_Video6x6,
+		&PokeMini_Video7x7
+	};
+
+	PokeMini_VideoPalette_Init(PokeMini_BGR16, 1);
+	if (!PokeMini_SetVideo((TPokeMini_VideoSpec *)specs[scale-1], depth, CommandLine.lcdfilter, CommandLine.lcdmode)) return 0;
+	PokeMini_VideoPalette_Index(CommandLine.palette, NULL, CommandLine.lcdcontrast, CommandLine.lcdbright);
+	return 1;
+}
+
+// RGB565 to XRGB8888, low bits replicated so white stays white
+static void PokeMiniBench_Convert(uint32_t *out, const uint16_t *in, int pixels)
+{
+	uint32_t c, r, g, b;
+	int i;
+
+	for (i=0; i<pixels; i++) {
+		c = in[i];
+		r = (c >> 11) & 0x1F;
+		g = (c >> 5) & 0x3F;
+		b = c & 0x1F;
+		out[i] = (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+	}
+}
+
+// Time snapshot save and restore
+static int PokeMiniBench_Snapshot(void)
+{
+	TPokeMini_Snapshot *snap;
+	uint64_t start, savetime, loadtime;
+	int i, runs = 100000;
+
+	snap = (TPokeMini_Snapshot *)malloc(sizeof(TPokeMini_Snapshot));
+	if (!snap) return 0;
+	start = PokeMiniBench_Clock();
+	for (i=0; i<runs; i++) PokeMini_SaveSnapshot(snap);
+	savetime = PokeMiniBench_Clock() - start;
+	start = PokeMiniBench_Clock();
+	for (i=0; i<runs; i++) {
+		if (!PokeMini_LoadSnapshot(snap)) {
+			free(snap);
+			return 0;
+		}
+	}
+	loadtime = PokeMiniBench_Clock() - start;
+	free(snap);
+
+	printf("snapshot_size=%i\n", (int)sizeof(TPokeMini_Snapshot));
+	printf("snapshot_save_ns=%.1f\n", (double)savetime / runs);
+	printf("snapshot_load_ns=%.1f\n", (double)loadtime / runs);
+	return 1;
+}
+
+// Time compact savestate save and load
+static int PokeMiniBench_CompactState(void)
+{
+	uint8_t *state;
+	uint64_t start, savetime, loadtime;
+	int i, size = 0, runs = 10000;
+
+	state = (uint8_t *)malloc(0x10000);
+	if (!state) return 0;
+	size = PokeMini_SaveSSStream(state, 0x10000);
+	if (!size) {
+		free(state);
+		return 0;
+	}
+	printf("state_size=%i\n", size);
+	start = PokeMiniBench_Clock();
+	for (i=0; i<runs; i++) size = PokeMini_SaveSSStreamCompact(state, 0x10000);
+	savetime = PokeMiniBench_Clock() - start;
+	start = PokeMiniBench_Clock();
+	for (i=0; i<runs; i++) {
+		if (!PokeMini_LoadSSStream(state, size)) {
+			free(state);
+			return 0;
+		}
+	}
+	loadtime = PokeMiniBench_Clock() - start;
+	free(state);
+
+	printf("state_compact_size=%i\n", size);
+	printf("state_compact_save_ns=%.1f\n", (double)savetime / runs);
+	printf("state_compact_load_ns=%.1f\n", (double)loadtime / runs);
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *romfile = NULL;
+	int frames = 3600;
+	int synccycles = 0;
+	int engine = MINX_AUDIO_GENERATED;
+	int blitscale = 0, audio = 0, profile = 1, snapshot = 0;
+	int depth = 16, convert = 0;
+	uint64_t outputtime = 0, outputstart;
+	int rewindsize = 0;
+	TPokeMini_Rewind *rewind = NULL;
+	uint64_t rewindtime = 0, rewindstart;
+	int runahead = 0, runaheadhide = 1, j;
+	TPokeMini_Snapshot *runaheadsnap = NULL;
+	int statehash = 0;
+	uint64_t hash = 0, hashtime = 0, hashstart;
+	void *video = NULL;
+	uint32_t *converted = NULL;
+	int16_t *samples = NULL;
+	uint64_t cycles = 0, start, total, staged;
+	double secs;
+	int i;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-f") && (i+1 < argc)) frames = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-s") && (i+1 < argc)) synccycles = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-e") && (i+1 < argc)) engine = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-b") && (i+1 < argc)) blitscale = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-d") && (i+1 < argc)) depth = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-c")) convert = 1;
+		else if (!strcmp(argv[i], "-a")) audio = 1;
+		else if (!strcmp(argv[i], "-P")) profile = 0;
+		else if (!strcmp(argv[i], "-S")) snapshot = 1;
+		else if (!strcmp(argv[i], "-R") && (i+1 < argc)) rewindsize = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-A") && (i+1 < argc)) runahead = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-H")) runaheadhide = 0;
+		else if (!strcmp(argv[i], "-K")) statehash = 1;
+		else romfile = argv[i];
+	}
+	if (!romfile || (frames <= 0) || (synccycles < 0) || (engine < 0) || (engine > 2) || (blitscale < 0) || (blitscale > 7) || ((depth != 16) && (depth != 32)) || (convert && (depth != 16)) || (rewindsize < 0) || (runahead < 0)) {
+		fprintf(stderr, "Usage: %s [-f frames] [-s synccycles] [-e engine] [-b scale] [-d depth] [-c] [-a] [-P] [-S] [-R bytes] [-A frames] [-H] [-K] rom.min\n", argv[0]);
+		return 1;
+	}
+
+	CommandLineInit();
+	CommandLine.updatertc = 0;	// Keep runs deterministic
+	CommandLine.synccycles = synccycles;
+	if (!PokeMini_Create(0, 4096)) {
+		fprintf(stderr, "Error creating emulator\n");
+		return 1;
+	}
+	if (blitscale) {
+		video = calloc(96 * 64 * blitscale * blitscale, depth / 8);
+		if (convert) converted = (uint32_t *)calloc(96 * 64 * blitscale * blitscale, sizeof(uint32_t));
+		if (!video || (convert && !converted) || !PokeMiniBench_SetVideo(blitscale, depth)) {
+			fprintf(stderr, "Error setting video\n");
+			PokeMini_Destroy();
+			return 1;
+		}
+	}
+	if (rewindsize) {
+		rewind = PokeMini_RewindCreate(rewindsize);
+		if (!rewind) {
+			fprintf(stderr, "Error creating rewind buffer\n");
+			PokeMini_Destroy();
+			return 1;
+		}
+	}
+	if (runahead) {
+		runaheadsnap = (TPokeMini_Snapshot *)malloc(sizeof(TPokeMini_Snapshot));
+		if (!runaheadsnap) {
+			fprintf(stderr, "Error allocating run-ahead snapshot\n");
+			PokeMini_Destroy();
+			return 1;
+		}
+	}
+	if (audio) samples = (int16_t *)malloc(PokeMiniBench_SamplesPerFrame[1] * 2 * sizeof(int16_t));
+	PokeMini_ApplyChanges();
+	MinxAudio_ChangeEngine(engine);
+	if (!PokeMini_BenchLoadMIN(romfile)) {
+		fprintf(stderr, "Error loading ROM '%s'\n", romfile);
+		PokeMini_Destroy();
+		return 1;
+	}
+	MinxIO_FormatEEPROM();
+	PokeMini_Reset(1);
+
+	// Renderer is chosen by the LCD mode, wrap it once that is settled
+	PokeMiniBench_PRCRender = MinxPRC_Render;
+	if (profile) {
+		MinxPRC_Render = PokeMiniBench_Render;
+		PokeMini_ProfClock = PokeMiniBench_Clock;
+	}
+	memset(PokeMini_ProfTime, 0, sizeof(PokeMini_ProfTime));
+
+	start = PokeMiniBench_Clock();
+	for (i=0; i<frames; i++) {
+		cycles += PokeMini_EmulateFrame();
+		if (runahead) {
+			// Only the last frame ahead is shown, none is heard
+			PokeMini_SaveSnapshot(runaheadsnap);
+			for (j=1; j<=runahead; j++) {
+				if (runaheadhide) PokeMini_HiddenFrame = POKEMINI_HIDE_AUDIO | ((j < runahead) ? POKEMINI_HIDE_VIDEO : 0);
+				PokeMini_EmulateFrame();
+			}
+			PokeMini_HiddenFrame = 0;
+		}
+		if (video) {
+			outputstart = PokeMiniBench_Clock();
+			PokeMini_ProfEnter(POKEMINI_PROF_BLIT);
+			PokeMini_VideoBlit(video, 96 * blitscale);
+			PokeMini_ProfLeave();
+			if (converted) PokeMiniBench_Convert(converted, (const uint16_t *)video, 96 * 64 * blitscale * blitscale);
+			outputtime += PokeMiniBench_Clock() - outputstart;
+		}
+		if (runahead) PokeMini_LoadSnapshot(runaheadsnap);
+		if (samples) {
+			PokeMini_ProfEnter(POKEMINI_PROF_AUDIO);
+			MinxAudio_GetSamplesS16Ch(samples, PokeMiniBench_SamplesPerFrame[i & 1], 2);
+			PokeMini_ProfLeave();
+		}
+		if (rewind) {
+			rewindstart = PokeMiniBench_Clock();
+			PokeMini_RewindPush(rewind);
+			rewindtime += PokeMiniBench_Clock() - rewindstart;
+		}
+		if (statehash) {
+			hashstart = PokeMiniBench_Clock();
+			hash = PokeMini_StateHash(NULL);
+			hashtime += PokeMiniBench_Clock() - hashstart;
+		}
+	}
+	total = PokeMiniBench_Clock() - start;
+	PokeMini_ProfClock = NULL;
+	MinxPRC_Render = PokeMiniBench_PRCRender;
+
+	secs = total > 0 ? (double)total / 1e9 : 1e-9;
+	printf("rom=%s\n", romfile);
+	printf("frames=%i\n", frames);
+	printf("synccycles=%i\n", synccycles);
+	printf("engine=%i\n", engine);
+	printf("blit=%i\n", blitscale);
+	if (video) {
+		printf("depth=%i\n", depth);
+		printf("convert=%i\n", convert);
+	}
+	printf("audio=%i\n", audio);
+	printf("runahead=%i\n", runahead);
+	printf("cycles=%llu\n", (unsigned long long)cycles);
+	printf("seconds=%.6f\n", (double)total / 1e9);
+	printf("fps=%.2f\n", (double)frames / secs);
+	printf("cps=%.0f\n", (double)cycles / secs);
+	if (profile) {
+		staged = 0;
+		for (i=0; i<POKEMINI_PROF_STAGES; i++) {
+			printf("stage_%s=%.6f\n", PokeMiniBench_StageName[i], (double)PokeMini_ProfTime[i] / 1e9);
+			staged += PokeMini_ProfTime[i];
+		}
+		printf("stage_other=%.6f\n", (double)(total > staged ? total - staged : 0) / 1e9);
+	}
+	if (video) printf("output_ns=%.1f\n", (double)outputtime / frames);
+	if (rewind) {
+		printf("rewind_size=%i\n", rewindsize);
+		printf("rewind_frames=%i\n", rewind->Frames);
+		printf("rewind_bytes_per_frame=%.1f\n", PokeMini_RewindBytesPerFrame(rewind));
+		printf("rewind_push_ns=%.1f\n", (double)rewindtime / frames);
+	}
+	if (statehash) {
+		printf("state_hash=%016llx\n", (unsigned long long)hash);
+		printf("state_hash_ns=%.1f\n", (double)hashtime / frames);
+	}
+	if (snapshot && !PokeMiniBench_Snapshot()) {
+		fprintf(stderr, "Error restoring snapshot\n");
+		PokeMini_Destroy();
+		return 1;
+	}
+	if (snapshot && !PokeMiniBench_CompactState()) {
+		fprintf(stderr, "Error loading compact savestate\n");
+		PokeMini_Destroy();
+		return 1;
+	}
+
+	PokeMini_RewindDestroy(rewind);
+	free(runaheadsnap);
+	free(samples);
+	free(converted);
+	free(video);
+	PokeMini_Destroy();
+	return 0;
+}
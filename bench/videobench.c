@@ -0,0 +1,185 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2015  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Video benchmark
+//
+// Checks that the dot-matrix vector blitters from Video_Blit.h draw the same
+// pixels as the scalar ones, for every scale, depth and LCD mode on random
+// LCD contents and palettes, then times both. Output is drawn with a padded pitch
+// over a filled buffer so writes outside the frame are caught too.
+// Output is one "key=value" line per blitter.
+//
+// Usage: videobench [-n iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "PokeMini.h"
+#include "Video.h"
+#include "Video_Scale.h"
+
+#define VIDEOBENCH_PAD 13
+#define VIDEOBENCH_FILL 0xA5
+
+static const struct {
+	const char *name;
+	const TPokeMini_VideoSpec *spec;
+} VideoBench_Specs[] = {
+	{ "1x1", &PokeMini_Video1x1 },
+	{ "2x2", &PokeMini_Video2x2 },
+	{ "3x3", &PokeMini_Video3x3 },
+	{ "4x4", &PokeMini_Video4x4 },
+	{ "5x5", &PokeMini_Video5x5 },
+	{ "6x6", &PokeMini_Video6x6 },
+	{ "7x7", &PokeMini_Video7x7 },
+	{ "2x2_NDS", &PokeMini_Video2x2_NDS }
+};
+#define VIDEOBENCH_NUMSPECS (int)(sizeof(VideoBench_Specs) / sizeof(VideoBench_Specs[0]))
+
+static const char *VideoBench_Filter[3] = { "none", "matrix", "scanline" };
+static const char *VideoBench_LCDMode[4] = { "analog", "3shades", "2shades", "color" };
+
+static uint8_t VideoBench_PixA[96*64], VideoBench_PixD[96*64];
+static uint8_t VideoBench_Color[96*64], VideoBench_ColorOld[96*64];
+static uint16_t VideoBench_Pal16[3][256], VideoBench_PalH16[65536];
+static uint32_t VideoBench_Pal32[3][256], VideoBench_PalH32[65536];
+
+static uint32_t VideoBench_Rand(uint32_t *seed)
+{
+	*seed = *seed * 1103515245 + 12345;
+	return *seed >> 8;
+}
+
+// Random LCD contents and palettes
+static void VideoBench_Init(void)
+{
+	uint32_t seed = 0xC0FFEE;
+	int i, j;
+
+	for (i=0; i<96*64; i++) {
+		VideoBench_PixA[i] = (uint8_t)VideoBench_Rand(&seed);
+		VideoBench_PixD[i] = (uint8_t)(VideoBench_Rand(&seed) & 1);
+		VideoBench_Color[i] = (uint8_t)VideoBench_Rand(&seed);
+		VideoBench_ColorOld[i] = (uint8_t)VideoBench_Rand(&seed);
+	}
+	for (j=0; j<3; j++) {
+		for (i=0; i<256; i++) {
+			VideoBench_Pal16[j][i] = (uint16_t)VideoBench_Rand(&seed);
+			VideoBench_Pal32[j][i] = VideoBench_Rand(&seed) ^ (VideoBench_Rand(&seed) << 16);
+		}
+	}
+	for (i=0; i<65536; i++) {
+		VideoBench_PalH16[i] = (uint16_t)VideoBench_Rand(&seed);
+		VideoBench_PalH32[i] = VideoBench_Rand(&seed) ^ (VideoBench_Rand(&seed) << 16);
+	}
+	LCDPixelsA = VideoBench_PixA;
+	LCDPixelsD = VideoBench_PixD;
+	PRCColorPixels = VideoBench_Color;
+	PRCColorPixelsOld = VideoBench_ColorOld;
+	VidPalette16 = VideoBench_Pal16[0];
+	VidPalColor16 = VideoBench_Pal16[1];
+	VidPalColorH16 = VideoBench_PalH16;
+	VidPalette32 = VideoBench_Pal32[0];
+	VidPalColor32 = VideoBench_Pal32[1];
+	VidPalColorH32 = VideoBench_PalH32;
+	MinxLCD.Pixel0Intensity = 17;
+	MinxLCD.Pixel1Intensity = 200;
+}
+
+// Draw one frame, pitch in output words
+static void VideoBench_Draw(const TPokeMini_VideoSpec *spec, int bpp, int filter, int lcdmode, void *buf, int pitchW)
+{
+	if (bpp == 32) spec->Get32(filter, lcdmode)((uint32_t *)buf, pitchW);
+	else spec->Get16(filter, lcdmode)((uint16_t *)buf, pitchW);
+}
+
+static double VideoBench_Time(const TPokeMini_VideoSpec *spec, int bpp, int filter, int lcdmode, void *buf, int pitchW, uint32_t iterations)
+{
+	clock_t start = clock();
+	uint32_t n;
+	for (n=0; n<iterations; n++) VideoBench_Draw(spec, bpp, filter, lcdmode, buf, pitchW);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t iterations = 1000, mismatches, total = 0;
+	uint8_t *bufScalar, *bufSIMD;
+	double t1, t2;
+	int i, s, bpp, filter, lcdmode, highcolor, pitchW, size;
+
+	for (i=1; i<argc; i++) {
+		if (!strcmp(argv[i], "-n") && (i+1 < argc)) iterations = (uint32_t)atoi(argv[++i]);
+		else {
+			fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+			return 1;
+		}
+	}
+	VideoBench_Init();
+
+	printf("iterations=%u\n", iterations);
+	for (s=0; s<VIDEOBENCH_NUMSPECS; s++) {
+		for (bpp=16; bpp<=32; bpp+=16) {
+			pitchW = 96 * VideoBench_Specs[s].spec->WScale + VIDEOBENCH_PAD;
+			size = pitchW * (64 * VideoBench_Specs[s].spec->HScale + 1) * (bpp / 8);
+			bufScalar = (uint8_t *)malloc(size);
+			bufSIMD = (uint8_t *)malloc(size);
+			if (!bufScalar || !bufSIMD) {
+				fprintf(stderr, "Out of memory\n");
+				return 1;
+			}
+			for (filter=0; filter<3; filter++) {
+				// Other filters have no vector path
+				if (filter != PokeMini_Matrix) continue;
+				for (lcdmode=0; lcdmode<4; lcdmode++) {
+					for (highcolor=0; highcolor<2; highcolor++) {
+						// High color only changes the colored dot-matrix
+						if (highcolor && ((filter != PokeMini_Matrix) || (lcdmode != 3))) continue;
+						VidEnableHighcolor = highcolor;
+
+						memset(bufScalar, VIDEOBENCH_FILL, size);
+						memset(bufSIMD, VIDEOBENCH_FILL, size);
+						VidEnableSIMD = 0;
+						VideoBench_Draw(VideoBench_Specs[s].spec, bpp, filter, lcdmode, bufScalar, pitchW);
+						VidEnableSIMD = 1;
+						VideoBench_Draw(VideoBench_Specs[s].spec, bpp, filter, lcdmode, bufSIMD, pitchW);
+						mismatches = 0;
+						for (i=0; i<size; i+=bpp/8) {
+							if (memcmp(bufScalar + i, bufSIMD + i, bpp/8)) mismatches++;
+						}
+						total += mismatches;
+
+						VidEnableSIMD = 0;
+						t1 = VideoBench_Time(VideoBench_Specs[s].spec, bpp, filter, lcdmode, bufScalar, pitchW, iterations);
+						VidEnableSIMD = 1;
+						t2 = VideoBench_Time(VideoBench_Specs[s].spec, bpp, filter, lcdmode, bufSIMD, pitchW, iterations);
+						printf("video=%s bpp=%i filter=%s lcdmode=%s highcolor=%i mismatches=%u scalar=%.6f simd=%.6f speedup=%.3f\n",
+							VideoBench_Specs[s].name, bpp, VideoBench_Filter[filter], VideoBench_LCDMode[lcdmode], highcolor,
+							mismatches, t1, t2, t2 > 0.0 ? t1 / t2 : 0.0);
+					}
+				}
+			}
+			free(bufScalar);
+			free(bufSIMD);
+		}
+	}
+	printf("match=%i\n", total == 0);
+	return total ? 2 : 0;
+}
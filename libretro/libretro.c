@@ -21,17 +21,12 @@
 #include "MinxIO.h"
 #include "PMCommon.h"
 #include "PokeMini.h"
+#include "Rewind.h"
 #include "Hardware.h"
 #include "Joystick.h"
 #include "MinxAudio.h"
 #include "Video.h"
-#include "Video_x1.h"
-#include "Video_x2.h"
-#include "Video_x3.h"
-#include "Video_x4.h"
-#include "Video_x5.h"
-#include "Video_x6.h"
-#include "Video_x7.h"
+#include "Video_Scale.h"
 
 #ifdef _3DS
 void* linearMemAlign(size_t size, size_t alignment);
@@ -43,7 +38,7 @@ void linearFree(void* mem);
 #define PMSOUNDBUFF	(SOUNDBUFFER*2)
 
 // Save state size
-#define PM_SS_SIZE 44014
+#define PM_SS_SIZE 44178
 
 // Screen parameters
 #define PM_SCEEN_WIDTH     96
@@ -54,7 +49,10 @@ static uint16_t video_scale = 1;
 static uint16_t video_width = PM_SCEEN_WIDTH;
 static uint16_t video_height = PM_SCEEN_HEIGHT;
 
-static uint16_t *video_buffer = NULL;
+static void *video_buffer = NULL;
+
+// Bits per pixel, 16 = RGB565, 32 = XRGB8888
+static int video_bpp = 16;
 
 // > In the original standalone code, 'pixel pitch' is defined as
 //      (SDL_Surface->pitch / 2)
@@ -125,9 +123,29 @@ static uint16_t turbo_period      = TURBO_PERIOD_DEFAULT;
 static uint16_t turbo_pulse_width = TURBO_PULSE_WIDTH_DEFAULT;
 static uint16_t turbo_counter     = 0;
 
+// Hardware sync interval chosen for this platform, used
+// unless the event driven scheduler is selected
+static int platform_synccycles = 8;
+
+// Rewind buffer, stepped back while L2 is held
+#define DEVICE_ID_REWIND RETRO_DEVICE_ID_JOYPAD_L2
+
+static TPokeMini_Rewind *rewind_buffer = NULL;
+static uint32_t rewind_size            = 0;
+
+// Run-ahead, frames emulated past the current one to show
+static int run_ahead_frames                   = 0;
+static TPokeMini_Snapshot *run_ahead_snapshot = NULL;
+
 // Frontend notification flags
 static bool update_av_info = false;
 
+// Duplicate frames, while the LCD doesn't change the
+// frontend repeats the last frame shown
+static bool libretro_supports_dupe = false;
+static bool video_redraw           = true;
+static bool video_shaken           = false;
+
 // Utilities
 ///////////////////////////////////////////////////////////
 
@@ -144,6 +162,7 @@ static void InitialiseInputDescriptors(void)
 		{ 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_L,      "Shake" },
 		{ 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_R,      "C" },
 		{ 0, RETRO_DEVICE_JOYPAD, 0, RETRO_DEVICE_ID_JOYPAD_SELECT, "Power" },
+		{ 0, RETRO_DEVICE_JOYPAD, 0, DEVICE_ID_REWIND,              "Rewind" },
 		{ 0 },
 	};
 	
@@ -269,6 +288,66 @@ static void InitialiseAudio(void)
 
 ///////////////////////////////////////////////////////////
 
+static void DeinitialiseRewind(void)
+{
+	if (!rewind_buffer)
+		return;
+
+	if (log_cb)
+		log_cb(RETRO_LOG_INFO, "Rewind: %.1f bytes per frame (%u bytes per snapshot)\n",
+				PokeMini_RewindBytesPerFrame(rewind_buffer),
+				(unsigned)sizeof(TPokeMini_Snapshot));
+
+	PokeMini_RewindDestroy(rewind_buffer);
+	rewind_buffer = NULL;
+}
+
+///////////////////////////////////////////////////////////
+
+static void InitialiseRewind(void)
+{
+	if (rewind_buffer && (rewind_buffer->Size != rewind_size))
+		DeinitialiseRewind();
+
+	if (rewind_size && !rewind_buffer)
+	{
+		rewind_buffer = PokeMini_RewindCreate(rewind_size);
+		if (!rewind_buffer && log_cb)
+			log_cb(RETRO_LOG_ERROR, "Failed to allocate rewind buffer.\n");
+	}
+	else if (!rewind_size)
+		DeinitialiseRewind();
+}
+
+///////////////////////////////////////////////////////////
+
+static void DeinitialiseRunAhead(void)
+{
+	if (run_ahead_snapshot)
+		free(run_ahead_snapshot);
+	run_ahead_snapshot = NULL;
+}
+
+///////////////////////////////////////////////////////////
+
+static void InitialiseRunAhead(void)
+{
+	if (!run_ahead_frames)
+	{
+		DeinitialiseRunAhead();
+		return;
+	}
+
+	if (!run_ahead_snapshot)
+	{
+		run_ahead_snapshot = (TPokeMini_Snapshot *)malloc(sizeof(TPokeMini_Snapshot));
+		if (!run_ahead_snapshot && log_cb)
+			log_cb(RETRO_LOG_ERROR, "Failed to allocate run-ahead snapshot.\n");
+	}
+}
+
+///////////////////////////////////////////////////////////
+
 static void SyncCoreOptionsWithCommandLine(bool startup)
 {
 	struct retro_variable variables = {0};
@@ -400,9 +479,53 @@ static void SyncCoreOptionsWithCommandLine(bool startup)
 		CommandLine.rumblelvl = atoi(variables.value);
 	}
 	
+	// pokemini_idleskip
+	CommandLine.idleskip = 0; // OFF
+	variables.key = "pokemini_idleskip";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variables))
+	{
+		if (strcmp(variables.value, "enabled") == 0)
+		{
+			CommandLine.idleskip = 1;
+		}
+		else if (strcmp(variables.value, "whitelist") == 0)
+		{
+			CommandLine.idleskip = 2;
+		}
+	}
+	
+	// pokemini_hwsync
+	CommandLine.synccycles = platform_synccycles;
+	variables.key = "pokemini_hwsync";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variables))
+	{
+		if (strcmp(variables.value, "events") == 0)
+		{
+			CommandLine.synccycles = 0;
+		}
+	}
+	
 	// NB: The following parameters are not part of the 'CommandLine'
 	// interface, but there is no better place to handle them...
 	
+	// pokemini_rewind
+	rewind_size = 0;
+	variables.key = "pokemini_rewind";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variables))
+	{
+		rewind_size = (uint32_t)strtol(variables.value, NULL, 10) << 20;
+	}
+	InitialiseRewind();
+	
+	// pokemini_run_ahead
+	run_ahead_frames = 0;
+	variables.key = "pokemini_run_ahead";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variables))
+	{
+		run_ahead_frames = atoi(variables.value);
+	}
+	InitialiseRunAhead();
+	
 	// pokemini_lowpass_filter
 	low_pass_enabled = false;
 	variables.key = "pokemini_lowpass_filter";
@@ -531,6 +654,7 @@ static void InitialiseCommandLine(const struct retro_game_info *game)
 	CommandLine.synccycles = 8; // Default 'accurate' setting
 	CommandLine.sound = MINX_AUDIO_DIRECTPWM;
 #endif
+	platform_synccycles = CommandLine.synccycles;
 	
 	// Set overrides read from core options
 	SyncCoreOptionsWithCommandLine(true);
@@ -559,6 +683,9 @@ static void InitialiseCommandLine(const struct retro_game_info *game)
 		// >> Set CommandLine.eeprom_file
 		extract_basename(g_basename, game->path, sizeof(g_basename));
 		sprintf(CommandLine.eeprom_file, "%s%c%s.eep", g_save_dir, slash, g_basename);
+		// >> Set CommandLine.idle_file (left unset if the path doesn't fit)
+		if (snprintf(CommandLine.idle_file, PMTMPV, "%s%c%s.idl", g_save_dir, slash, g_basename) >= PMTMPV)
+			CommandLine.idle_file[0] = '\0';
 	}
 	// > BIOS path
 	// >> Set CommandLine.bios_file
@@ -684,6 +811,34 @@ static void InitialiseVideo(void)
 {
 	struct retro_variable variables = {0};
 	TPokeMini_VideoSpec *video_spec = NULL;
+	enum retro_pixel_format format;
+
+	// Get pixel format, XRGB8888 spares frontends whose
+	// output can't take RGB565 a conversion every frame
+	video_bpp = 16;
+	variables.key = "pokemini_pixel_format";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &variables) && variables.value)
+	{
+		if (strcmp(variables.value, "xrgb8888") == 0)
+			video_bpp = 32;
+	}
+	if (video_bpp == 32)
+	{
+		format = RETRO_PIXEL_FORMAT_XRGB8888;
+		if (environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &format))
+		{
+			if (log_cb)
+				log_cb(RETRO_LOG_INFO, "Frontend supports XRGB8888 - will use that.\n");
+		}
+		else
+			video_bpp = 16;
+	}
+	if (video_bpp == 16)
+	{
+		format = RETRO_PIXEL_FORMAT_RGB565;
+		if (environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &format) && log_cb)
+			log_cb(RETRO_LOG_INFO, "Frontend supports RGB565 - will use that instead of XRGB1555.\n");
+	}
 
 	// Get video scale
 #if defined(_3DS)
@@ -748,9 +903,9 @@ static void InitialiseVideo(void)
 	if (!video_buffer)
 	{
 #ifdef _3DS
-		video_buffer = (uint16_t*)linearMemAlign(sizeof(uint16_t) * video_width * video_height, 128);
+		video_buffer = linearMemAlign((video_bpp >> 3) * video_width * video_height, 128);
 #else
-		video_buffer = (uint16_t*)calloc(video_width * video_height, sizeof(uint16_t));
+		video_buffer = calloc(video_width * video_height, video_bpp >> 3);
 #endif
 	}
 	
@@ -781,7 +936,7 @@ static void InitialiseVideo(void)
 	}
 	
 	// Set video spec and check if supported
-	if (!PokeMini_SetVideo(video_spec, 16, CommandLine.lcdfilter, CommandLine.lcdmode))
+	if (!PokeMini_SetVideo(video_spec, video_bpp, CommandLine.lcdfilter, CommandLine.lcdmode))
 	{
 		if (log_cb)
 			log_cb(RETRO_LOG_ERROR, "Couldn't set video spec.\n");
@@ -791,25 +946,46 @@ static void InitialiseVideo(void)
 
 ///////////////////////////////////////////////////////////
 
+// Address of pixel 'index' in video buffer
+static void *VideoBufferAt(int index)
+{
+	return (uint8_t *)video_buffer + index * (video_bpp >> 3);
+}
+
+///////////////////////////////////////////////////////////
+
 // Set specified area of array to zero
-static void ZeroArray(uint16_t array[], int size)
+static void ZeroArray(void *array, int size)
 {
-	int i;
-	for (i = 0; i < size; i++)
-		array[i] = 0;
+	if (size > 0)
+		memset(array, 0, size * (video_bpp >> 3));
 }
 
 ///////////////////////////////////////////////////////////
 
 // Classic 'reverse' function, from 'Programming Pearls' by Jon Bentley
-static void ReverseArray(uint16_t array[], int size)
+static void ReverseArray(void *array, int size)
 {
 	int i, j;
-	for (i = 0, j = size; i < j; i++, j--)
+	if (video_bpp == 32)
+	{
+		uint32_t *array32 = (uint32_t *)array;
+		for (i = 0, j = size; i < j; i++, j--)
+		{
+			uint32_t tmp = array32[i];
+			array32[i] = array32[j];
+			array32[j] = tmp;
+		}
+	}
+	else
 	{
-		uint16_t tmp = array[i];
-		array[i] = array[j];
-		array[j] = tmp;
+		uint16_t *array16 = (uint16_t *)array;
+		for (i = 0, j = size; i < j; i++, j--)
+		{
+			uint16_t tmp = array16[i];
+			array16[i] = array16[j];
+			array16[j] = tmp;
+		}
 	}
 }
 
@@ -829,12 +1005,12 @@ static void SetPixelOffset(void)
 		{
 			row_offset = buffer_size + row_offset;
 			ZeroArray(video_buffer, buffer_size - row_offset - 1);
-			ReverseArray(video_buffer + buffer_size - row_offset, row_offset - 1);
+			ReverseArray(VideoBufferAt(buffer_size - row_offset), row_offset - 1);
 		}
 		else
 		{
 			ReverseArray(video_buffer, buffer_size - row_offset - 1);
-			ZeroArray(video_buffer + buffer_size - row_offset, row_offset - 1);
+			ZeroArray(VideoBufferAt(buffer_size - row_offset), row_offset - 1);
 		}
 
 		ReverseArray(video_buffer, buffer_size - 1);
@@ -995,14 +1171,14 @@ void retro_get_system_av_info(struct retro_system_av_info *info)
 
 void retro_init (void)
 {
-	enum retro_pixel_format rgb565 = RETRO_PIXEL_FORMAT_RGB565;
-
-	if(environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &rgb565) && log_cb)
-		log_cb(RETRO_LOG_INFO, "Frontend supports RGB565 - will use that instead of XRGB1555.\n");
-
 	libretro_supports_bitmasks = false;
 	if (environ_cb(RETRO_ENVIRONMENT_GET_INPUT_BITMASKS, NULL))
 		libretro_supports_bitmasks = true;
+
+	libretro_supports_dupe = false;
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &libretro_supports_dupe))
+		libretro_supports_dupe = false;
+	video_redraw = true;
 }
 
 ///////////////////////////////////////////////////////////
@@ -1029,6 +1205,16 @@ void retro_deinit(void)
 	turbo_counter     = 0;
 
 	update_av_info = false;
+
+	libretro_supports_dupe = false;
+	video_redraw           = true;
+	video_shaken           = false;
+
+	DeinitialiseRewind();
+	rewind_size = 0;
+
+	DeinitialiseRunAhead();
+	run_ahead_frames = 0;
 }
 
 ///////////////////////////////////////////////////////////
@@ -1037,8 +1223,78 @@ void retro_reset (void)
 {
 	// Soft reset
 	PokeMini_Reset(0);
+	if (rewind_buffer)
+		PokeMini_RewindClear(rewind_buffer);
 
 	low_pass_prev = 0;
+	video_redraw = true;
+}
+
+///////////////////////////////////////////////////////////
+
+static void EmulateFrame(bool rewinding)
+{
+	if (rewinding)
+	{
+		PokeMini_RewindStep(rewind_buffer);
+		return;
+	}
+
+	PokeMini_EmulateFrame();
+	if (rewind_buffer)
+		PokeMini_RewindPush(rewind_buffer);
+}
+
+///////////////////////////////////////////////////////////
+
+// Frontend-owned framebuffer, so the frame isn't copied again
+// after the blit. Returns NULL when the frontend has none or it
+// doesn't match the current video mode
+static void *GetFrontendFramebuffer(int *pitchW)
+{
+	struct retro_framebuffer fb;
+	enum retro_pixel_format format = (video_bpp == 32) ?
+			RETRO_PIXEL_FORMAT_XRGB8888 : RETRO_PIXEL_FORMAT_RGB565;
+	unsigned bytes = video_bpp >> 3;
+
+	memset(&fb, 0, sizeof(fb));
+	fb.width = video_width;
+	fb.height = video_height;
+	fb.access_flags = RETRO_MEMORY_ACCESS_WRITE;
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb) || !fb.data)
+		return NULL;
+	if ((fb.format != format) ||
+		 (fb.width != video_width) || (fb.height != video_height) ||
+		 (fb.pitch % bytes) || (fb.pitch < video_width * bytes))
+		return NULL;
+
+	*pitchW = (int)(fb.pitch / bytes);
+	return fb.data;
+}
+
+///////////////////////////////////////////////////////////
+
+static void RunAheadBlit(void *frame, int pitchW)
+{
+	int hidden = PokeMini_HiddenFrame;
+	int i;
+
+	// Emulate ahead with the current input, only the last
+	// frame is rendered and none is heard, then go back
+	PokeMini_SaveSnapshot(run_ahead_snapshot);
+	for (i = 1; i <= run_ahead_frames; i++)
+	{
+		PokeMini_HiddenFrame = POKEMINI_HIDE_AUDIO;
+		if (i < run_ahead_frames)
+			PokeMini_HiddenFrame |= POKEMINI_HIDE_VIDEO;
+		else
+			LCDDirty = 1;
+		PokeMini_EmulateFrame();
+	}
+	PokeMini_HiddenFrame = hidden;
+
+	PokeMini_VideoBlit(frame, pitchW);
+	PokeMini_LoadSnapshot(run_ahead_snapshot);
 }
 
 ///////////////////////////////////////////////////////////
@@ -1046,6 +1302,11 @@ void retro_reset (void)
 void retro_run (void)
 {
 	size_t audio_samples_per_frame;
+	bool rewinding;
+	bool shake;
+	int av_enable = 3;
+	void *frame = video_buffer;
+	int frame_pitch = pix_pitch;
 	
 	// Check for core options updates
 	bool options_updated = false;
@@ -1054,11 +1315,22 @@ void retro_run (void)
 		SyncCoreOptionsWithCommandLine(false);
 		PokeMini_VideoPalette_Index(CommandLine.palette, NULL, CommandLine.lcdcontrast, CommandLine.lcdbright);
 		PokeMini_ApplyChanges();
+		video_redraw = true;
 	}
 	
 	poll_cb();
 	handlekeyevents();
 	
+	rewinding = rewind_buffer &&
+			(input_cb(0, RETRO_DEVICE_JOYPAD, 0, DEVICE_ID_REWIND) != 0);
+	
+	// Frontend may discard the output of this frame
+	// (bit 0: video, bit 1: audio), as with its own
+	// run-ahead. The state is kept, so only the blit
+	// and audio samples can be skipped
+	environ_cb(RETRO_ENVIRONMENT_GET_AUDIO_VIDEO_ENABLE, &av_enable);
+	PokeMini_HiddenFrame = (av_enable & 2) ? 0 : POKEMINI_HIDE_AUDIO;
+	
 	// Must set audio_samples_per_frame after
 	// SyncCoreOptionsWithCommandLine(), since
 	// toggling 60Hz mode will reset
@@ -1077,7 +1349,7 @@ void retro_run (void)
 		/* Emulate 'force skipped frame' */
 		if (retro_60hz_counter == 0)
 		{
-			PokeMini_EmulateFrame();
+			EmulateFrame(rewinding);
 			
 			MinxAudio_GetSamplesS16Ch(retro_audio.samples_mono +
 							retro_audio.samples_pos,
@@ -1092,7 +1364,7 @@ void retro_run (void)
 		}
 
 		/* Run 'regular' frame */
-		PokeMini_EmulateFrame();
+		EmulateFrame(rewinding);
 
 		MinxAudio_GetSamplesS16Ch(retro_audio.samples_mono +
 						retro_audio.samples_pos,
@@ -1103,7 +1375,7 @@ void retro_run (void)
 	}
 	else
 	{
-		PokeMini_EmulateFrame();
+		EmulateFrame(rewinding);
 		
 		// - If low pass filter is enabled, read mono
 		//   samples and upmix in the filter
@@ -1133,12 +1405,39 @@ void retro_run (void)
 		update_av_info = false;
 	}
 	
+	// Frame identical to the last one shown, nothing changed the LCD
+	// and no screen shake to draw or to undo. Run-ahead and rewind
+	// show frames from other states, so they are always drawn
+	shake = PokeMini_Rumbling && CommandLine.rumblelvl;
+	if ((av_enable & 1) && libretro_supports_dupe && !video_redraw &&
+		 !PokeMini_LCDUpdated && !shake && !video_shaken &&
+		 !run_ahead_snapshot && !rewinding)
+		av_enable &= ~1;
+	
 	// Fetch, process and output video
-	PokeMini_VideoBlit((uint16_t *)video_buffer, pix_pitch);
+	if (av_enable & 1)
+	{
+		// Screen shake rotates the whole frame, it stays in video_buffer
+		if (!shake)
+		{
+			frame = GetFrontendFramebuffer(&frame_pitch);
+			if (!frame)
+			{
+				frame = video_buffer;
+				frame_pitch = pix_pitch;
+			}
+		}
+		
+		if (run_ahead_snapshot && !rewinding)
+			RunAheadBlit(frame, frame_pitch);
+		else
+			PokeMini_VideoBlit(frame, frame_pitch);
+	}
 	
 	if (PokeMini_Rumbling)
 	{
-		SetPixelOffset();
+		if (frame == video_buffer)
+			SetPixelOffset();
 		ActivateControllerRumble();
 	}
 	else
@@ -1147,8 +1446,15 @@ void retro_run (void)
 	}
 	
 	LCDDirty = 0;
+	if (av_enable & 1)
+	{
+		PokeMini_LCDUpdated = 0;
+		video_redraw = false;
+		video_shaken = shake;
+	}
 	
-	video_cb(video_buffer, video_width, video_height, video_width * 2/*Pitch*/);
+	video_cb((av_enable & 1) ? frame : NULL,
+			video_width, video_height, frame_pitch * (video_bpp >> 3)/*Pitch*/);
 	
 	// Output audio
 	if (retro_60hz_enabled)
@@ -1179,6 +1485,11 @@ void retro_run (void)
 			AudioUpmix(retro_audio.samples_mono,
 					retro_audio.samples_stereo, samples_to_read);
 
+		// Silence while rewinding
+		if (rewinding)
+			memset(retro_audio.samples_stereo, 0,
+					(samples_to_read << 1) * sizeof(int16_t));
+
 		audio_batch_cb(retro_audio.samples_stereo,
 				samples_to_read);
 		
@@ -1191,8 +1502,14 @@ void retro_run (void)
 		retro_audio.samples_pos -= samples_to_read;
 	}
 	else
+	{
+		if (rewinding)
+			memset(retro_audio.samples_stereo, 0,
+					(audio_samples_per_frame << 1) * sizeof(int16_t));
+
 		audio_batch_cb(retro_audio.samples_stereo,
 				audio_samples_per_frame);
+	}
 
 	retro_audio.per_frame_72hz_index =
 			(retro_audio.per_frame_72hz_index + 1) & 0x1;
@@ -1224,6 +1541,8 @@ bool retro_serialize(void *data, size_t size)
 bool retro_unserialize(const void *data, size_t size)
 {
 	if (PokeMini_LoadSSStream((uint8_t*)data, size)) {
+		if (rewind_buffer) PokeMini_RewindClear(rewind_buffer);
+		video_redraw = true;
 		if (log_cb) log_cb(RETRO_LOG_INFO, "Save state loaded successfully.\n");
 	} else {
 		if (log_cb) log_cb(RETRO_LOG_ERROR, "Failed to load save state.\n");
@@ -1288,6 +1607,15 @@ bool retro_load_game(const struct retro_game_info *game)
 			log_cb(RETRO_LOG_INFO, "Read EEPROM file: %s\n", CommandLine.eeprom_file);
 	}
 	
+	// Load idle loops list
+	MinxCPU_IdleClear();
+	if (FileExist(CommandLine.idle_file))
+	{
+		PokeMini_LoadIdleFile(CommandLine.idle_file);
+		if (log_cb)
+			log_cb(RETRO_LOG_INFO, "Read idle loops file: %s\n", CommandLine.idle_file);
+	}
+	
 	// Soft reset
 	PokeMini_Reset(0);
 	
@@ -1350,6 +1678,14 @@ void retro_unload_game(void)
 			log_cb(RETRO_LOG_INFO, "Wrote EEPROM file: %s\n", CommandLine.eeprom_file);
 	}
 	
+	// Save idle loops report
+	if (CommandLine.idleskip && MinxCPU_IdleNum && StringIsSet(CommandLine.idle_file))
+	{
+		PokeMini_SaveIdleFile(CommandLine.idle_file);
+		if (log_cb)
+			log_cb(RETRO_LOG_INFO, "Wrote idle loops file: %s\n", CommandLine.idle_file);
+	}
+	
 	// Terminate emulator
 	PokeMini_VideoPalette_Free();
 	PokeMini_Destroy();
@@ -1367,6 +1703,12 @@ void retro_unload_game(void)
 
 	// Deallocate audio buffers
 	DeinitialiseAudio();
+
+	// Deallocate rewind buffer
+	DeinitialiseRewind();
+
+	// Deallocate run-ahead snapshot
+	DeinitialiseRunAhead();
 }
 
 // Useless (?) callbacks
@@ -71,6 +71,17 @@ struct retro_core_option_definition option_defs_us[] = {
       "4x"
 #endif
    },
+   {
+      "pokemini_pixel_format",
+      "Color Format (Restart)",
+      "Pixel format of the video output. 'XRGB8888' draws frames in the format most frontends display, so they don't need converting every frame, at twice the memory per frame.",
+      {
+         { "rgb565",   "RGB565 (16-bit)" },
+         { "xrgb8888", "XRGB8888 (32-bit)" },
+         { NULL, NULL },
+      },
+      "rgb565"
+   },
    {
       "pokemini_60hz_mode",
       "60Hz Mode",
@@ -372,6 +383,56 @@ struct retro_core_option_definition option_defs_us[] = {
       },
       "18"
    },
+   {
+      "pokemini_hwsync",
+      "Hardware Sync",
+      "How often timers, LCD and audio catch up with the CPU. 'Events' runs the CPU straight up to the next hardware change, as accurate as syncing on every cycle and usually faster than 'Interval'. 'Interval' syncs every few cycles, with a longer interval on slower platforms.",
+      {
+         { "interval", "Interval" },
+         { "events",   "Events" },
+         { NULL, NULL },
+      },
+      "interval"
+   },
+   {
+      "pokemini_idleskip",
+      "Idle Loop Skip",
+      "Detect game loops that only wait for hardware and skip their remaining iterations. 'whitelist' only skips loops marked in the idle file of the game. Disables threaded dispatch.",
+      {
+         { "disabled",  NULL },
+         { "enabled",   NULL },
+         { "whitelist", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pokemini_rewind",
+      "Rewind Buffer",
+      "Keep a history of recent frames in memory, rewound while L2 is held. Frames are stored as compressed differences, so a few MB hold minutes of gameplay.",
+      {
+         { "disabled", NULL },
+         { "4",        "4 MB" },
+         { "16",       "16 MB" },
+         { "64",       "64 MB" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pokemini_run_ahead",
+      "Run-Ahead",
+      "Emulate frames ahead with the current input and show the last one, hiding that many frames of the game's own input lag. Frames in between skip rendering, so each one costs less than a full frame.",
+      {
+         { "disabled", NULL },
+         { "1",        NULL },
+         { "2",        NULL },
+         { "3",        NULL },
+         { "4",        NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    { NULL, NULL, NULL, {{0}}, NULL },
 };
 
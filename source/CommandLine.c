@@ -20,7 +20,7 @@
 
 #include "PokeMini.h"
 
-TCommandLine CommandLine;
+POKEMINI_TLS TCommandLine CommandLine;
 
 void CommandLineInit(void)
 {
@@ -30,6 +30,7 @@ void CommandLineInit(void)
 	// Default strings
 	strcpy(CommandLine.bios_file, "bios.min");
 	strcpy(CommandLine.eeprom_file, "PokeMini.eep");
+	strcpy(CommandLine.idle_file, "PokeMini.idl");
 
 	// Default booleans / integers
 	CommandLine.forcefreebios = 0;	// Force FreeBIOS
@@ -70,4 +71,5 @@ void CommandLineInit(void)
 #else
 	CommandLine.synccycles = 8;	// Sync cycles to 8 (Accurant)
 #endif
+	CommandLine.idleskip = 0;	// Idle loop skip (0=Off, 1=Auto, 2=Whitelist)
 }
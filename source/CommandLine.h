@@ -20,11 +20,13 @@
 #define COMMAND_LINE
 
 #include <stdint.h>
+#include "PMCommon.h"
 
 typedef struct {
 	int forcefreebios;
 	char bios_file[PMTMPV];
 	char eeprom_file[PMTMPV];
+	char idle_file[PMTMPV];
 	int updatertc;
 	int eeprom_share;
 	int sound;
@@ -38,13 +40,14 @@ typedef struct {
 	int joybutton[10];
 	int multicart;
 	int synccycles;
+	int idleskip;
 	uint32_t custompal[4];
 	int lcdcontrast;
 	int lcdbright;
 } TCommandLine;
 
 // Extern command line structure
-extern TCommandLine CommandLine;
+extern POKEMINI_TLS TCommandLine CommandLine;
 
 // Process arguments parsing into the command line structure
 void CommandLineInit(void);
@@ -17,37 +17,177 @@
 */
 
 #include "PokeMini.h"
+#include "Hardware.h"
+
+#ifdef POKEMINI_PROFILE
+
+#define POKEMINI_PROF_DEPTH	8
+
+POKEMINI_TLS uint64_t PokeMini_ProfTime[POKEMINI_PROF_STAGES];
+POKEMINI_TLS uint64_t (*PokeMini_ProfClock)(void) = NULL;
+static POKEMINI_TLS int PokeMini_ProfStack[POKEMINI_PROF_DEPTH];
+static POKEMINI_TLS int PokeMini_ProfDepth = 0;
+static POKEMINI_TLS uint64_t PokeMini_ProfMark;
+
+// Charge the time since the last mark to the running stage
+static void PokeMini_ProfCharge(void)
+{
+	uint64_t now = PokeMini_ProfClock();
+
+	if ((PokeMini_ProfDepth > 0) && (PokeMini_ProfDepth <= POKEMINI_PROF_DEPTH)) {
+		PokeMini_ProfTime[PokeMini_ProfStack[PokeMini_ProfDepth-1]] += now - PokeMini_ProfMark;
+	}
+	PokeMini_ProfMark = now;
+}
+
+void PokeMini_ProfEnter(int stage)
+{
+	if (!PokeMini_ProfClock) return;
+	PokeMini_ProfCharge();
+	if (PokeMini_ProfDepth < POKEMINI_PROF_DEPTH) PokeMini_ProfStack[PokeMini_ProfDepth] = stage;
+	PokeMini_ProfDepth++;
+}
+
+void PokeMini_ProfLeave(void)
+{
+	if (!PokeMini_ProfClock || (PokeMini_ProfDepth <= 0)) return;
+	PokeMini_ProfCharge();
+	PokeMini_ProfDepth--;
+}
+
+#endif
 
 /* Emulate 1 frame, return cycles ran */
-static int PokeMini_EmulateFrameRun;
+static POKEMINI_TLS int PokeMini_EmulateFrameRun;
+static POKEMINI_TLS int PokeMini_EventSync = 0;	// CPU is running under the event scheduler
+static POKEMINI_TLS int PokeMini_SyncedCycles = 0;	// Cycles already synced on the current CPU run
+
+// Run hardware for N cycles
+static INLINE void PokeMini_SyncHardware(int cycles)
+{
+	PokeHWCycles = cycles;
+	POKEMINI_PROF_ENTER(POKEMINI_PROF_TIMERS);
+	MinxTimers_Sync();
+	POKEMINI_PROF_LEAVE();
+	MinxPRC_Sync();
+	if (RequireSoundSync) MinxAudio_Sync();
+}
+
+// Cycles until the earliest hardware event the CPU can see
+static INLINE int PokeMini_NextVisibleEvent(void)
+{
+	int next = MinxTimers_NextEvent();
+	int cycles = MinxPRC_NextEvent();
+
+	return (cycles < next) ? cycles : next;
+}
+
+// Cycles until the earliest hardware event
+static INLINE int PokeMini_NextEvent(void)
+{
+	int next = PokeMini_NextVisibleEvent();
+	int cycles;
+
+	if (RequireSoundSync) {
+		cycles = MinxAudio_NextEvent();
+		if (cycles < next) next = cycles;
+	}
+	return next;
+}
+
+// Bring hardware up to the current instruction before an I/O access
+static INLINE void PokeMini_CatchUp(void)
+{
+	if (PokeMini_EventSync && (MinxCPU_RunCycles > PokeMini_SyncedCycles)) {
+		PokeMini_SyncHardware(MinxCPU_RunCycles - PokeMini_SyncedCycles);
+		PokeMini_SyncedCycles = MinxCPU_RunCycles;
+	}
+}
+
+// Cycles a halted CPU can skip on the fixed sync, in whole sync steps
+//   Each step is what MinxCPU_Run() returns for a halted CPU
+static INLINE int PokeMini_HaltCycles(int synccylc)
+{
+	int step = (synccylc + 7) & ~7;
+	int steps = PokeMini_NextEvent() / step;
+
+	if (steps < 1) steps = 1;
+	return steps * step;
+}
 
 int PokeMini_EmulateFrame(void)
 {
 	int lcylc    = 0;
 	int synccylc = CommandLine.synccycles;
+	int cycles, visible;
 
 	PokeMini_EmulateFrameRun = 1;
+	MinxCPU_IdleResume = 0;
 
-	if (RequireSoundSync) {
+	if (synccylc <= 0) {
+		// Event driven, the CPU runs until the next hardware event
+		//   I/O accesses sync the hardware up to the accessing instruction,
+		//   I/O writes also end the run as they may move the next event
 		while (PokeMini_EmulateFrameRun) {
-			PokeHWCycles = 0;
-			while (PokeHWCycles < synccylc) {
-				if (StallCPU) PokeHWCycles += StallCycles;
-				else PokeHWCycles += MinxCPU_Exec();
+			visible = PokeMini_NextVisibleEvent();
+			cycles = visible;
+			if (RequireSoundSync && (MinxAudio_NextEvent() < cycles)) cycles = MinxAudio_NextEvent();
+			if (StallCPU) {
+				// Stall in steps of StallCycles, same as the fixed sync
+				cycles = (cycles + StallCycles - 1) / StallCycles * StallCycles;
+				PokeMini_SyncHardware(cycles);
+				MinxCPU_IdleResume = 0;
+			} else {
+				PokeMini_SyncedCycles = 0;
+				PokeMini_EventSync = 1;
+				POKEMINI_PROF_ENTER(POKEMINI_PROF_CPU);
+				cycles = MinxCPU_Run(cycles);
+				POKEMINI_PROF_LEAVE();
+				PokeMini_EventSync = 0;
+				PokeMini_SyncHardware(cycles - PokeMini_SyncedCycles);
+				// Only audio synced, idle loops can go on
+				MinxCPU_IdleResume = (cycles < visible);
 			}
+			lcylc += cycles;
+		}
+	} else if (RequireSoundSync) {
+		while (PokeMini_EmulateFrameRun) {
+			if (!StallCPU && MinxCPU_Halted()) {
+				// Skip to the next hardware event
+				PokeHWCycles = PokeMini_HaltCycles(synccylc);
+			} else {
+				PokeHWCycles = 0;
+				POKEMINI_PROF_ENTER(POKEMINI_PROF_CPU);
+				while (PokeHWCycles < synccylc) {
+					if (StallCPU) PokeHWCycles += StallCycles;
+					else PokeHWCycles += MinxCPU_Run(synccylc - PokeHWCycles);
+				}
+				POKEMINI_PROF_LEAVE();
+			}
+			POKEMINI_PROF_ENTER(POKEMINI_PROF_TIMERS);
 			MinxTimers_Sync();
+			POKEMINI_PROF_LEAVE();
 			MinxPRC_Sync();
 			MinxAudio_Sync();
 			lcylc += PokeHWCycles;
 		}
 	} else {
 		while (PokeMini_EmulateFrameRun) {
-			PokeHWCycles = 0;
-			while (PokeHWCycles < synccylc) {
-				if (StallCPU) PokeHWCycles += StallCycles;
-				else PokeHWCycles += MinxCPU_Exec();
+			if (!StallCPU && MinxCPU_Halted()) {
+				// Skip to the next hardware event
+				PokeHWCycles = PokeMini_HaltCycles(synccylc);
+			} else {
+				PokeHWCycles = 0;
+				POKEMINI_PROF_ENTER(POKEMINI_PROF_CPU);
+				while (PokeHWCycles < synccylc) {
+					if (StallCPU) PokeHWCycles += StallCycles;
+					else PokeHWCycles += MinxCPU_Run(synccylc - PokeHWCycles);
+				}
+				POKEMINI_PROF_LEAVE();
 			}
+			POKEMINI_PROF_ENTER(POKEMINI_PROF_TIMERS);
 			MinxTimers_Sync();
+			POKEMINI_PROF_LEAVE();
 			MinxPRC_Sync();
 			lcylc += PokeHWCycles;
 		}
@@ -56,10 +196,62 @@ int PokeMini_EmulateFrame(void)
 	return lcylc;
 }
 
+// Rebuild CPU memory page table
+//   Call after changing BIOS, ROM, multicart type or color map
+void PokeMini_MapMemory(void)
+{
+	uint32_t addr;
+
+	// ROM (mirrored across the whole space)
+	MinxCPU_MapPages(0, 0x200000, NULL, NULL);
+#ifdef PERFORMANCE
+	if (PM_ROM && (PM_ROM_Size >= MINX_PAGE_SIZE)) {
+#else
+	if (PM_ROM && (PM_ROM_Size >= MINX_PAGE_SIZE) && (PM_MM_Type == 0)) {
+#endif
+		for (addr = 0; addr < 0x200000; addr += PM_ROM_Size) {
+			MinxCPU_MapPages(addr, PM_ROM_Size, PM_ROM, NULL);
+		}
+	}
+
+	// BIOS
+	MinxCPU_MapPages(0x0000, 0x1000, PM_BIOS, NULL);
+
+	// RAM (Framebuffer writes need color PRC update)
+	MinxCPU_MapPages(0x1000, 0x1000, PM_RAM, PM_RAM);
+	if (PRCColorMap) MinxCPU_MapPages(0x1000, 0x300, PM_RAM, NULL);
+
+	// I/O
+	MinxCPU_MapPages(0x2000, 0x100, NULL, NULL);
+}
+
 // -------------------
 // Internal Processing
 // -------------------
 
+// Idle loop tracking, how long the register reads the same
+static void PokeMini_IdleRead(uint8_t reg)
+{
+	switch(reg) {
+		// Timers interface
+		case 0x09: case 0x0A: case 0x0B:
+		case 0x36: case 0x37: case 0x3E: case 0x3F:
+		case 0x41: case 0x4E: case 0x4F:
+			MinxCPU_IdleRead(MinxTimers_ReadHorizon(reg));
+			return;
+
+		// Program Rendering Chip interface
+		case 0x8A:
+			MinxCPU_IdleRead(MinxPRC_ReadHorizon(reg));
+			return;
+
+		// Reads with side effects
+		case 0xF3: case 0xFE: case 0xFF:
+			MinxCPU_IdleRead(0);
+			return;
+	}
+}
+
 uint8_t MinxCPU_OnRead(int cpu, uint32_t addr)
 {
 #ifdef PERFORMANCE
@@ -77,6 +269,8 @@ uint8_t MinxCPU_OnRead(int cpu, uint32_t addr)
 	} else if (addr >= 0x2000) {
 		// I/O Read
 		uint8_t reg = (uint8_t)addr;
+		PokeMini_CatchUp();
+		if (MinxCPU_IdleTrack) PokeMini_IdleRead(reg);
 		switch(reg) {
 			// Misc interface
 			case 0x00: // System Control 1
@@ -163,6 +357,10 @@ void MinxCPU_OnWrite(int cpu, uint32_t addr, uint8_t data)
 	} else if (addr >= 0x2000) {
 		// I/O Write
 		uint8_t reg = (uint8_t)addr;
+		if (PokeMini_EventSync) {
+			PokeMini_CatchUp();
+			MinxCPU_RunBreak = 1;
+		}
 		switch(reg) {
 			// Misc interface
 			case 0x00: // System Control 1
@@ -231,10 +429,12 @@ void MinxCPU_OnWrite(int cpu, uint32_t addr, uint8_t data)
 	} else if (addr >= 0x1300) {
 		// RAM Write
 		PM_RAM[addr-0x1000] = data;
+		MinxCPU_MarkRAM(addr);
 		return;
 	} else if (addr >= 0x1000) {
 		// RAM Write / FrameBuffer
 		PM_RAM[addr-0x1000] = data;
+		MinxCPU_MarkRAM(addr);
 		if (PRCColorMap) MinxColorPRC_WriteFramebuffer(addr-0x1000, data);
 		return;
 	}
@@ -269,8 +469,27 @@ void MinxIRQ_OnIRQ(uint8_t intr)
 void MinxPRC_On72HzRefresh(int prcrender)
 {
 	// Frame rendered
-	if ((PokeMini_LCDMode == LCDMODE_3SHADES) && (prcrender)) memcpy(LCDPixelsA, LCDPixelsD, 96*64);
-	if (LCDDirty) MinxLCD_Render();
-	if (PokeMini_LCDMode == LCDMODE_ANALOG) MinxLCD_DecayRefresh();
+	if (PokeMini_HiddenFrame & POKEMINI_HIDE_VIDEO) {
+		PokeMini_EmulateFrameRun = 0;
+		return;
+	}
+	if ((PokeMini_LCDMode == LCDMODE_3SHADES) && (prcrender)) {
+		if (memcmp(LCDPixelsA, LCDPixelsD, 96*64)) {
+			memcpy(LCDPixelsA, LCDPixelsD, 96*64);
+			PokeMini_LCDUpdated = 1;
+		}
+	}
+	if (LCDDirty) {
+		POKEMINI_PROF_ENTER(POKEMINI_PROF_LCD);
+		MinxLCD_Render();
+		POKEMINI_PROF_LEAVE();
+		PokeMini_LCDUpdated = 1;
+	}
+	if (PokeMini_LCDMode == LCDMODE_ANALOG) {
+		// Pixels keep fading for a few frames after the last change
+		if (MinxLCD_DecayRefresh()) PokeMini_LCDUpdated = 1;
+	}
+	// Color PRC pixels are written without marking the LCD dirty
+	if (PokeMini_LCDMode == LCDMODE_COLORS) PokeMini_LCDUpdated = 1;
 	PokeMini_EmulateFrameRun = 0;
 }
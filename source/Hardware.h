@@ -22,4 +22,38 @@
 /* Emulate 1 frame, return cycles ran */
 int PokeMini_EmulateFrame(void);
 
+#ifdef POKEMINI_PROFILE
+
+// Host time per emulation stage, for headless benchmarks
+//   Time is exclusive, a stage running inside another isn't counted twice
+enum {
+	POKEMINI_PROF_CPU = 0,	// MinxCPU_Run
+	POKEMINI_PROF_TIMERS,	// MinxTimers_Sync
+	POKEMINI_PROF_PRC,	// MinxPRC_Render
+	POKEMINI_PROF_LCD,	// MinxLCD_Render
+	POKEMINI_PROF_BLIT,	// PokeMini_VideoBlit
+	POKEMINI_PROF_AUDIO,	// MinxAudio_GetSamplesS16Ch
+	POKEMINI_PROF_STAGES
+};
+
+// Accumulated time in clock units
+extern POKEMINI_TLS uint64_t PokeMini_ProfTime[POKEMINI_PROF_STAGES];
+
+// Host clock, profiling is disabled while NULL
+extern POKEMINI_TLS uint64_t (*PokeMini_ProfClock)(void);
+
+// Mark the start and end of a stage
+void PokeMini_ProfEnter(int stage);
+void PokeMini_ProfLeave(void);
+
+#define POKEMINI_PROF_ENTER(stage)	PokeMini_ProfEnter(stage)
+#define POKEMINI_PROF_LEAVE()	PokeMini_ProfLeave()
+
+#else
+
+#define POKEMINI_PROF_ENTER(stage)
+#define POKEMINI_PROF_LEAVE()
+
+#endif
+
 #endif
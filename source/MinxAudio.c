@@ -22,18 +22,21 @@
 #include "gw_malloc.h"
 #endif
 
-TMinxAudio MinxAudio;
-int AudioEnabled = 0;
-int SoundEngine = MINX_AUDIO_DISABLED;
-int PiezoFilter = 0;
-int RequireSoundSync = 0;
-int16_t *MinxAudio_FIFO = NULL;
-volatile int MinxAudio_ReadPtr = 0;
-volatile int MinxAudio_WritePtr = 0;
-int MinxAudio_FIFOSize = 0;
-int MinxAudio_FIFOMask = 0;
-int MinxAudio_FIFOThreshold = 0;
-int16_t (*MinxAudio_AudioProcess)(void) = NULL;
+POKEMINI_TLS TMinxAudio MinxAudio;
+POKEMINI_TLS int AudioEnabled = 0;
+POKEMINI_TLS int SoundEngine = MINX_AUDIO_DISABLED;
+POKEMINI_TLS int PiezoFilter = 0;
+POKEMINI_TLS int RequireSoundSync = 0;
+POKEMINI_TLS int16_t *MinxAudio_FIFO = NULL;
+POKEMINI_TLS volatile int MinxAudio_ReadPtr = 0;
+POKEMINI_TLS volatile int MinxAudio_WritePtr = 0;
+POKEMINI_TLS int MinxAudio_FIFOSize = 0;
+POKEMINI_TLS int MinxAudio_FIFOMask = 0;
+POKEMINI_TLS int MinxAudio_FIFOThreshold = 0;
+POKEMINI_TLS int16_t (*MinxAudio_AudioProcess)(void) = NULL;
+
+// Piezo filter history
+POKEMINI_TLS int32_t MinxAudio_HPSamples[4], MinxAudio_LPSamples[4];
 
 // Timers counting frequency table
 const uint32_t MinxAudio_CountFreq[32] = {
@@ -131,13 +134,32 @@ void MinxAudio_Destroy(void)
 	}
 }
 
+// Swap instance state
+void MinxAudio_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxAudio);
+	POKESWAP(sw, AudioEnabled);
+	POKESWAP(sw, SoundEngine);
+	POKESWAP(sw, PiezoFilter);
+	POKESWAP(sw, RequireSoundSync);
+	POKESWAP(sw, MinxAudio_FIFO);
+	POKESWAP(sw, MinxAudio_ReadPtr);
+	POKESWAP(sw, MinxAudio_WritePtr);
+	POKESWAP(sw, MinxAudio_FIFOSize);
+	POKESWAP(sw, MinxAudio_FIFOMask);
+	POKESWAP(sw, MinxAudio_FIFOThreshold);
+	POKESWAP(sw, MinxAudio_AudioProcess);
+	POKESWAP(sw, MinxAudio_HPSamples);
+	POKESWAP(sw, MinxAudio_LPSamples);
+}
+
 void MinxAudio_Reset(int hardreset)
 {
 	// Initialize State
 	memset((void *)&MinxAudio, 0, sizeof(TMinxAudio));
 }
 
-int MinxAudio_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxAudio_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(32);
 	POKELOADSS_STREAM_32(MinxAudio.AudioCCnt);
@@ -148,7 +170,7 @@ int MinxAudio_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(32);
 }
 
-int MinxAudio_SaveStateStream(memstream_t *stream)
+int MinxAudio_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(32);
 	POKESAVESS_STREAM_32(MinxAudio.AudioCCnt);
@@ -210,7 +232,7 @@ void MinxAudio_Sync(void)
 	if (MinxAudio.AudioCCnt >= 0x01000000)
 	{
 		MinxAudio.AudioCCnt -= 0x01000000;
-		if (MinxAudio_AudioProcess)
+		if (MinxAudio_AudioProcess && !(PokeMini_HiddenFrame & POKEMINI_HIDE_AUDIO))
 		{
 			if (PiezoFilter)
 				MinxAudio_FIFOWrite(MinxAudio_PiezoFilter(MinxAudio_AudioProcess()));
@@ -220,6 +242,13 @@ void MinxAudio_Sync(void)
 	}
 }
 
+// Cycles until MinxAudio_Sync processes the next sample, at least 1
+int MinxAudio_NextEvent(void)
+{
+	if (MinxAudio.AudioCCnt >= 0x01000000) return 1;
+	return (0x01000000 - MinxAudio.AudioCCnt + MINX_AUDIOINC - 1) / MINX_AUDIOINC;
+}
+
 uint8_t MinxAudio_ReadReg(uint8_t reg)
 {
 	// 0x70 to 0x71
@@ -327,15 +356,14 @@ int16_t MinxAudio_PiezoFilter(int32_t Sample)
 	int32_t HP_pCoeff = 40960;
 	int32_t LP_pCoeff = 4096;
 	int32_t LP_nCoeff = (65535 - LP_pCoeff);
-	static int32_t HPSamples[4], LPSamples[4];
 	int32_t TmpSamples[4];
 
 	// High pass to simulate a piezo crystal speaker
 	TmpSamples[0] = Sample;
-	TmpSamples[1] = (HP_pCoeff * (TmpSamples[0] + HPSamples[1] - HPSamples[0])) >> 16;
-	TmpSamples[2] = (HP_pCoeff * (TmpSamples[1] + HPSamples[2] - HPSamples[1])) >> 16;
-	TmpSamples[3] = (HP_pCoeff * (TmpSamples[2] + HPSamples[3] - HPSamples[2])) >> 16;
-	memcpy(HPSamples, TmpSamples, sizeof(HPSamples));
+	TmpSamples[1] = (HP_pCoeff * (TmpSamples[0] + MinxAudio_HPSamples[1] - MinxAudio_HPSamples[0])) >> 16;
+	TmpSamples[2] = (HP_pCoeff * (TmpSamples[1] + MinxAudio_HPSamples[2] - MinxAudio_HPSamples[1])) >> 16;
+	TmpSamples[3] = (HP_pCoeff * (TmpSamples[2] + MinxAudio_HPSamples[3] - MinxAudio_HPSamples[2])) >> 16;
+	memcpy(MinxAudio_HPSamples, TmpSamples, sizeof(MinxAudio_HPSamples));
 
 	// Amplify by 4
 	Sample = TmpSamples[3] << 2;
@@ -345,13 +373,13 @@ int16_t MinxAudio_PiezoFilter(int32_t Sample)
 		Sample = 32767;
 
 	// Low pass to kill the spikes in sound
-	LPSamples[0] = Sample;
-	LPSamples[1] = (LPSamples[1] * LP_pCoeff + LPSamples[0] * LP_nCoeff) >> 16;
-	LPSamples[2] = (LPSamples[2] * LP_pCoeff + LPSamples[1] * LP_nCoeff) >> 16;
-	LPSamples[3] = (LPSamples[3] * LP_pCoeff + LPSamples[2] * LP_nCoeff) >> 16;
+	MinxAudio_LPSamples[0] = Sample;
+	MinxAudio_LPSamples[1] = (MinxAudio_LPSamples[1] * LP_pCoeff + MinxAudio_LPSamples[0] * LP_nCoeff) >> 16;
+	MinxAudio_LPSamples[2] = (MinxAudio_LPSamples[2] * LP_pCoeff + MinxAudio_LPSamples[1] * LP_nCoeff) >> 16;
+	MinxAudio_LPSamples[3] = (MinxAudio_LPSamples[3] * LP_pCoeff + MinxAudio_LPSamples[2] * LP_nCoeff) >> 16;
 
 	// Amplify by 2, clamp and output
-	Sample = LPSamples[3] << 1;
+	Sample = MinxAudio_LPSamples[3] << 1;
 	if (Sample < -32768)
 		return -32768;
 	if (Sample > 32767)
@@ -22,9 +22,7 @@
 #include "MinxTimers.h"
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 typedef struct {
 	// Internal processing
@@ -35,19 +33,22 @@ typedef struct {
 } TMinxAudio;
 
 // Export Audio state
-extern TMinxAudio MinxAudio;
+extern POKEMINI_TLS TMinxAudio MinxAudio;
 
 // Audio enabled
-extern int AudioEnabled;
+extern POKEMINI_TLS int AudioEnabled;
 
 // Sound engine
-extern int SoundEngine;
+extern POKEMINI_TLS int SoundEngine;
 
 // Piezo Filter
-extern int PiezoFilter;
+extern POKEMINI_TLS int PiezoFilter;
 
 // Require sound sync
-extern int RequireSoundSync;
+extern POKEMINI_TLS int RequireSoundSync;
+
+// Piezo filter history
+extern POKEMINI_TLS int32_t MinxAudio_HPSamples[4], MinxAudio_LPSamples[4];
 
 
 enum {
@@ -79,11 +80,13 @@ int MinxAudio_Create(int audioenable, int fifosize);
 
 void MinxAudio_Destroy(void);
 
+void MinxAudio_SwapContext(TPokeMini_Swap *sw);
+
 void MinxAudio_Reset(int hardreset);
 
-int MinxAudio_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxAudio_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxAudio_SaveStateStream(memstream_t *stream);
+int MinxAudio_SaveStateStream(TPokeMini_Stream *stream);
 
 void MinxAudio_ChangeEngine(int engine);
 
@@ -91,6 +94,8 @@ void MinxAudio_ChangeFilter(int piezo);
 
 void MinxAudio_Sync(void);
 
+int MinxAudio_NextEvent(void);
+
 uint8_t MinxAudio_ReadReg(uint8_t reg);
 
 void MinxAudio_WriteReg(uint8_t reg, uint8_t val);
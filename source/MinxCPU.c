@@ -19,14 +19,238 @@
 #include "PokeMini.h"
 #include "MinxCPU.h"
 
-TMinxCPU MinxCPU;
+POKEMINI_TLS TMinxCPU MinxCPU;
+
+// Memory page table, NULL without instance
+POKEMINI_TLS uint8_t **MinxCPU_ReadPage = NULL;
+POKEMINI_TLS uint8_t **MinxCPU_WritePage = NULL;
+POKEMINI_TLS uint16_t MinxCPU_DirtyRAM = 0xFFFF;
+
+#ifdef MINX_THREADED
+POKEMINI_TLS int MinxCPU_Threaded = 1;
+POKEMINI_TLS int MinxCPU_ThreadedMin = 32;
+#endif
+POKEMINI_TLS uint32_t MinxCPU_Executed = 0;
+POKEMINI_TLS int MinxCPU_RunCycles = 0;
+POKEMINI_TLS int MinxCPU_RunBreak = 0;
+POKEMINI_TLS int MinxCPU_IdleSkip = MINX_IDLE_OFF;
+POKEMINI_TLS TMinxCPU_IdleLoop MinxCPU_IdleLoops[MINX_IDLE_LOOPS];
+POKEMINI_TLS int MinxCPU_IdleNum = 0;
+POKEMINI_TLS int MinxCPU_IdleTrack = 0;
+POKEMINI_TLS int MinxCPU_IdleHorizon = 0;
+POKEMINI_TLS int MinxCPU_IdleResume = 0;
+POKEMINI_TLS uint32_t MinxCPU_Writes = 0;
+
+// Confirmed idle loop, kept between runs while MinxCPU_IdleResume is set
+static POKEMINI_TLS struct {
+	TMinxCPU_IdleLoop *loop;	// Report entry, NULL if none
+	uint32_t writes;		// MinxCPU_Writes when confirmed
+	uint32_t limit;			// No iteration can start from this clock
+	TMinxCPU state;			// CPU state at loop start
+} MinxCPU_IdleCur;
+static POKEMINI_TLS uint32_t MinxCPU_IdleClock = 0;	// Cycles ran with idle detection
 
 //
 // Functions
 //
 
+// Map host memory into a range of pages, NULL to use callbacks
+void MinxCPU_MapPages(uint32_t addr, uint32_t size, uint8_t *rdmem, uint8_t *wrmem)
+{
+	uint32_t page = addr >> MINX_PAGE_SHIFT;
+	uint32_t last = (addr + size) >> MINX_PAGE_SHIFT;
+	if (!MinxCPU_ReadPage) return;
+	if (last > MINX_PAGE_COUNT) last = MINX_PAGE_COUNT;
+	for (; page < last; page++) {
+		MinxCPU_ReadPage[page] = rdmem;
+		MinxCPU_WritePage[page] = wrmem;
+		if (rdmem) rdmem += MINX_PAGE_SIZE;
+		if (wrmem) wrmem += MINX_PAGE_SIZE;
+	}
+}
+
+// Drop what was tied to the previous state, call after restoring RAM and registers
+void MinxCPU_Restored(void)
+{
+	MinxCPU_IdleCur.loop = NULL;
+	MinxCPU_IdleTrack = 0;
+	MinxCPU_IdleResume = 0;
+	MinxCPU_DirtyRAM = 0xFFFF;
+}
+
+// Find or add an idle loop, NULL if the list is full
+TMinxCPU_IdleLoop *MinxCPU_IdleLoop(uint32_t pc)
+{
+	TMinxCPU_IdleLoop *loop;
+	int i;
+
+	for (i=0; i<MinxCPU_IdleNum; i++) {
+		if (MinxCPU_IdleLoops[i].PC == pc) return &MinxCPU_IdleLoops[i];
+	}
+	if (MinxCPU_IdleNum >= MINX_IDLE_LOOPS) return NULL;
+	loop = &MinxCPU_IdleLoops[MinxCPU_IdleNum++];
+	memset(loop, 0, sizeof(TMinxCPU_IdleLoop));
+	loop->PC = pc;
+	return loop;
+}
+
+// Forget all idle loops
+void MinxCPU_IdleClear(void)
+{
+	MinxCPU_IdleCur.loop = NULL;
+	MinxCPU_IdleNum = 0;
+}
+
+// CPU state compared between loop iterations
+static INLINE void MinxCPU_IdleSave(TMinxCPU *st)
+{
+	*st = MinxCPU;
+}
+
+static INLINE int MinxCPU_IdleSame(TMinxCPU *st)
+{
+	return !memcmp(st, &MinxCPU, sizeof(TMinxCPU));
+}
+
+// Skip iterations of the current idle loop, return cycles skipped
+//   Stops before the end of the run and before any read may change
+static int MinxCPU_IdleIters(uint32_t clock, int left)
+{
+	TMinxCPU_IdleLoop *loop = MinxCPU_IdleCur.loop;
+	int limit = (int)(MinxCPU_IdleCur.limit - clock);
+	int iters = left / loop->Period;
+
+	if (limit <= 0) {
+		// Reads may change, confirm again
+		MinxCPU_IdleCur.loop = NULL;
+		return 0;
+	}
+	if ((limit - 1) / loop->Period + 1 < iters) iters = (limit - 1) / loop->Period + 1;
+	loop->Skipped += iters * loop->Period;
+	return iters * loop->Period;
+}
+
+// Loop confirmed idle, check white/blacklist
+static int MinxCPU_IdleAllow(TMinxCPU_IdleLoop *loop)
+{
+	if (!loop || (loop->Mode < 0)) return 0;
+	if ((MinxCPU_IdleSkip == MINX_IDLE_LISTED) && (loop->Mode <= 0)) return 0;
+	return 1;
+}
+
+// Execute with idle loop detection
+//   After a short backward jump the CPU state is saved, when the next jump
+//   lands on the same place with the same state one more iteration is
+//   watched for writes and for reads that are going to change
+static int MinxCPU_RunIdle(int cycles)
+{
+	TMinxCPU state;
+	TMinxCPU_IdleLoop *loop;
+	uint32_t clock = MinxCPU_IdleClock;
+	uint32_t pc, start = 0xFFFFFFFF;
+	uint32_t writes = 0;
+	int ran = 0, top = 0;
+
+	if (!MinxCPU_IdleResume) MinxCPU_IdleCur.loop = NULL;
+
+	while (ran < cycles) {
+		pc = MinxCPU.PC.D;
+		MinxCPU_RunCycles = ran;
+		ran += MinxCPU_Exec();
+		MinxCPU_Executed++;
+		if (MinxCPU_RunBreak) break;
+
+		// Short backward jump, including to itself
+		if ((MinxCPU.PC.D > pc) || (pc - MinxCPU.PC.D > MINX_IDLE_MAXLEN)) continue;
+		if (MinxCPU.Status != MINX_STATUS_NORMAL) continue;
+
+		// Back on the current idle loop
+		loop = MinxCPU_IdleCur.loop;
+		if (loop && (MinxCPU.PC.D == loop->PC)) {
+			if ((MinxCPU_Writes == MinxCPU_IdleCur.writes) && MinxCPU_IdleSame(&MinxCPU_IdleCur.state)) {
+				ran += MinxCPU_IdleIters(clock + ran, cycles - ran);
+				if (MinxCPU_IdleCur.loop) continue;
+			} else MinxCPU_IdleCur.loop = NULL;
+		}
+
+		if ((MinxCPU.PC.D == start) && MinxCPU_IdleSame(&state)) {
+			if (!MinxCPU_IdleTrack) {
+				// Watch next iteration
+				MinxCPU_IdleTrack = 1;
+				MinxCPU_IdleHorizon = 0x7FFFFFFF;
+				writes = MinxCPU_Writes;
+				top = ran;
+				continue;
+			}
+			MinxCPU_IdleTrack = 0;
+			if ((MinxCPU_Writes == writes) && (MinxCPU_IdleHorizon > 0)) {
+				loop = MinxCPU_IdleLoop(start);
+				if (loop) {
+					loop->Period = ran - top;
+					loop->Hits++;
+				}
+				if (MinxCPU_IdleAllow(loop)) {
+					MinxCPU_IdleCur.loop = loop;
+					MinxCPU_IdleCur.writes = writes;
+					MinxCPU_IdleCur.limit = clock + top + MinxCPU_IdleHorizon;
+					MinxCPU_IdleCur.state = state;
+					ran += MinxCPU_IdleIters(clock + ran, cycles - ran);
+				}
+				start = 0xFFFFFFFF;
+				continue;
+			}
+		}
+		MinxCPU_IdleTrack = 0;
+		start = MinxCPU.PC.D;
+		MinxCPU_IdleSave(&state);
+	}
+	MinxCPU_IdleTrack = 0;
+	MinxCPU_IdleClock = clock + ran;
+
+	return ran;
+}
+
+// Execute instructions until at least N cycles ran, return cycles ran
+int MinxCPU_Run(int cycles)
+{
+	int ran = 0;
+
+	MinxCPU_RunBreak = 0;
+
+	// HALT/STOP only end on IRQ, which hardware raises between runs,
+	// so the whole run is skipped in one step of 8 cycles NOPs
+	if (MinxCPU_Halted()) {
+		MinxCPU_IdleCur.loop = NULL;
+		if (cycles <= 0) return 0;
+		return (cycles + 7) & ~7;
+	}
+	if (MinxCPU_IdleSkip) return MinxCPU_RunIdle(cycles);
+	MinxCPU_IdleCur.loop = NULL;	// Writes aren't counted from here
+
+#ifdef MINX_THREADED
+	if (MinxCPU_Threaded && (cycles >= MinxCPU_ThreadedMin)) return MinxCPU_ExecThreaded(cycles);
+#endif
+	while (ran < cycles) {
+		MinxCPU_RunCycles = ran;
+		ran += MinxCPU_Exec();
+		MinxCPU_Executed++;
+		if (MinxCPU_RunBreak) break;
+	}
+	return ran;
+}
+
 int MinxCPU_Create(void)
 {
+	// Page table, filled by PokeMini_MapMemory()
+	if (!MinxCPU_ReadPage) {
+		MinxCPU_ReadPage = (uint8_t **)calloc(2 * MINX_PAGE_COUNT, sizeof(uint8_t *));
+		if (!MinxCPU_ReadPage) return 0;
+		MinxCPU_WritePage = MinxCPU_ReadPage + MINX_PAGE_COUNT;
+	}
+
+	// All RAM pages are new
+	MinxCPU_DirtyRAM = 0xFFFF;
+
 	// Init variables
 	MinxCPU.BA.D = 0;
 	MinxCPU.HL.D = 0;
@@ -44,7 +268,40 @@ int MinxCPU_Create(void)
 
 void MinxCPU_Destroy(void)
 {
-	// Nothing...
+	if (MinxCPU_ReadPage) {
+		free(MinxCPU_ReadPage);
+		MinxCPU_ReadPage = NULL;
+		MinxCPU_WritePage = NULL;
+	}
+}
+
+// Swap instance state
+//   Only the page table pointers move, each instance keeps its own table
+void MinxCPU_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxCPU);
+	POKESWAP(sw, MinxCPU_ReadPage);
+	POKESWAP(sw, MinxCPU_WritePage);
+#ifdef MINX_THREADED
+	POKESWAP(sw, MinxCPU_Threaded);
+	POKESWAP(sw, MinxCPU_ThreadedMin);
+#endif
+	POKESWAP(sw, MinxCPU_Executed);
+	POKESWAP(sw, MinxCPU_IdleSkip);
+	POKESWAP(sw, MinxCPU_IdleLoops);
+	POKESWAP(sw, MinxCPU_IdleNum);
+	POKESWAP(sw, MinxCPU_IdleResume);
+	POKESWAP(sw, MinxCPU_Writes);
+	POKESWAP(sw, MinxCPU_DirtyRAM);
+	POKESWAP(sw, MinxCPU_IdleCur);
+	POKESWAP(sw, MinxCPU_IdleClock);
+	if (POKESWAP_NEW(sw)) {
+#ifdef MINX_THREADED
+		MinxCPU_Threaded = 1;
+		MinxCPU_ThreadedMin = 32;
+#endif
+		MinxCPU_DirtyRAM = 0xFFFF;
+	}
 }
 
 // Reset core, call it after OnRead/OnWrite point to the right BIOS
@@ -59,7 +316,7 @@ void MinxCPU_Reset(int hardreset)
 }
 
 // Load State from stream
-int MinxCPU_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxCPU_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(64);
 	POKELOADSS_STREAM_32(MinxCPU.BA.D);
@@ -82,7 +339,7 @@ int MinxCPU_LoadStateStream(memstream_t *stream, uint32_t bsize)
 }
 
 // Save State to stream
-int MinxCPU_SaveStateStream(memstream_t *stream)
+int MinxCPU_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(64);
 	POKESAVESS_STREAM_32(MinxCPU.BA.D);
@@ -20,12 +20,9 @@
 #define MINXCPU_CORE
 
 #include <stdint.h>
+#include "PMCommon.h"
 #include <retro_inline.h>
 
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
-
 /* For some reason, '_BIG_ENDIAN' is always defined when
  * building for 3DS/Switch with devkitarm/a64... */
 #if defined (_BIG_ENDIAN) && !defined (_3DS) && !defined(HAVE_LIBNX)
@@ -111,7 +108,7 @@ typedef struct {
 } TMinxCPU;
 
 // CPU registers
-extern TMinxCPU MinxCPU;
+extern POKEMINI_TLS TMinxCPU MinxCPU;
 
 // Callbacks (Must be coded by the user)
 uint8_t MinxCPU_OnRead(int cpu, uint32_t addr);
@@ -119,35 +116,154 @@ void MinxCPU_OnWrite(int cpu, uint32_t addr, uint8_t data);
 void MinxCPU_OnIRQHandle(uint8_t flag, uint8_t shift_u);
 void MinxCPU_OnIRQAct(uint8_t intr);
 
+// Memory page table
+//   256 bytes per page across the 21-bit address space, each entry
+//   points to host memory for direct access or is NULL to fall back
+//   into the OnRead/OnWrite callbacks (I/O, flash, open-bus...)
+//   Each instance owns its table from MinxCPU_Create() to MinxCPU_Destroy()
+#define MINX_PAGE_SHIFT 	8
+#define MINX_PAGE_SIZE  	(1 << MINX_PAGE_SHIFT)
+#define MINX_PAGE_MASK  	(MINX_PAGE_SIZE - 1)
+#define MINX_PAGE_COUNT 	(0x200000 >> MINX_PAGE_SHIFT)
+
+extern POKEMINI_TLS uint8_t **MinxCPU_ReadPage;
+extern POKEMINI_TLS uint8_t **MinxCPU_WritePage;
+
+// Map host memory into a range of pages, NULL to use callbacks
+void MinxCPU_MapPages(uint32_t addr, uint32_t size, uint8_t *rdmem, uint8_t *wrmem);
+
+// RAM pages written, one bit per page from $1000. Whoever reads it clears
+// it, everything is set again after MinxCPU_Restored()
+extern POKEMINI_TLS uint16_t MinxCPU_DirtyRAM;
+#define MinxCPU_MarkRAM(addr)	(MinxCPU_DirtyRAM |= 1 << (((addr) >> MINX_PAGE_SHIFT) & 15))
+
+// Drop what was tied to the previous state, call after restoring RAM and registers
+void MinxCPU_Restored(void);
+
+// Threaded dispatch (labels as values, GCC and Clang only)
+//   Opcode handlers from MinxCPU_XX/CE/CF.c are compiled a second time
+//   into MinxCPU_ExecThreaded, each one jumping straight to the next
+#if defined(__GNUC__) && !defined(TARGET_GNW) && !defined(MINX_NOTHREADED)
+#define MINX_THREADED
+#endif
+
+#ifdef MINX_THREADED
+int MinxCPU_ExecThreaded(int cycles);	// Execute until at least N cycles ran
+extern POKEMINI_TLS int MinxCPU_Threaded;		// Use threaded dispatch in MinxCPU_Run
+extern POKEMINI_TLS int MinxCPU_ThreadedMin;		// Shorter runs use the switch (cheaper to enter)
+#endif
+extern POKEMINI_TLS uint32_t MinxCPU_Executed;	// Instructions executed by MinxCPU_Run
+
+// Run control, for callbacks invoked from inside MinxCPU_Run
+extern POKEMINI_TLS int MinxCPU_RunCycles;		// Cycles ran before the current instruction
+extern POKEMINI_TLS int MinxCPU_RunBreak;		// Set to return after the current instruction
+
+// Idle loop detection (MinxCPU_IdleSkip)
+//   A short backward loop that gets back to its start twice with the same
+//   CPU state, no memory writes and only stable reads will spin the same way
+//   until hardware changes something, remaining iterations are skipped.
+//   MinxCPU_OnRead lowers the horizon with MinxCPU_IdleRead while tracking.
+//   A confirmed loop carries over to the next run if the caller sets
+//   MinxCPU_IdleResume, meaning only counters covered by the horizon moved.
+//   Uses the switch dispatch, threaded runs are bypassed
+#define MINX_IDLE_MAXLEN	32	// Longest loop, in bytes
+#define MINX_IDLE_LOOPS		64	// Loops kept for the report
+
+enum {
+	MINX_IDLE_OFF = 0,	// No detection
+	MINX_IDLE_AUTO,		// Skip loops that aren't blacklisted
+	MINX_IDLE_LISTED	// Skip whitelisted loops only
+};
+
+typedef struct {
+	uint32_t PC;		// Loop start
+	int Mode;		// 1 = Whitelisted, 0 = Auto, -1 = Blacklisted
+	int Period;		// Cycles per iteration
+	uint32_t Hits;		// Times detected
+	uint64_t Skipped;	// Cycles skipped
+} TMinxCPU_IdleLoop;
+
+extern POKEMINI_TLS int MinxCPU_IdleSkip;		// Detection mode
+extern POKEMINI_TLS TMinxCPU_IdleLoop MinxCPU_IdleLoops[MINX_IDLE_LOOPS];
+extern POKEMINI_TLS int MinxCPU_IdleNum;		// Loops in MinxCPU_IdleLoops
+extern POKEMINI_TLS int MinxCPU_IdleTrack;		// Checking an iteration
+extern POKEMINI_TLS int MinxCPU_IdleHorizon;		// Cycles all reads stay unchanged
+extern POKEMINI_TLS int MinxCPU_IdleResume;		// Nothing visible changed since last run
+extern POKEMINI_TLS uint32_t MinxCPU_Writes;		// Memory writes, only counted with MinxCPU_IdleSkip
+
+TMinxCPU_IdleLoop *MinxCPU_IdleLoop(uint32_t pc);	// Find or add loop, NULL if full
+void MinxCPU_IdleClear(void);		// Forget all loops
+
+// Value just read won't change for N cycles, hardware events aside
+static INLINE void MinxCPU_IdleRead(int cycles)
+{
+	if (cycles < MinxCPU_IdleHorizon) MinxCPU_IdleHorizon = cycles;
+}
+
+// Opcode handler labels, MinxCPU_Threaded.c defines its own
+#ifndef MINX_THREADED_BODY
+#define MINX_OP(t, n)	case n
+#define MINX_RET(c)	return (c)
+#define MINX_PREFIX(t)	return MinxCPU_Exec##t()
+#endif
+
 // Functions
 int MinxCPU_Create(void);		// Create MinxCPU
 void MinxCPU_Destroy(void);		// Destroy MinxCPU
+void MinxCPU_SwapContext(TPokeMini_Swap *sw);	// Swap instance state
 void MinxCPU_Reset(int hardreset);	// Reset CPU
-int MinxCPU_LoadStateStream(memstream_t *stream, uint32_t bsize); // Load State from stream
-int MinxCPU_SaveStateStream(memstream_t *stream);	// Save State to stream
+int MinxCPU_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize); // Load State from stream
+int MinxCPU_SaveStateStream(TPokeMini_Stream *stream);	// Save State to stream
 int MinxCPU_Exec(void);			// Execute 1 CPU instruction
+int MinxCPU_Run(int cycles);		// Execute until at least N cycles ran
 int MinxCPU_CallIRQ(uint8_t IRQ);	// Call an IRQ
 
 // Helpers
+static INLINE uint8_t MinxCPU_Read(uint32_t addr)
+{
+	uint8_t *page;
+	if (addr < 0x200000) {
+		page = MinxCPU_ReadPage[addr >> MINX_PAGE_SHIFT];
+		if (page) return page[addr & MINX_PAGE_MASK];
+	}
+	return MinxCPU_OnRead(1, addr);
+}
+
+static INLINE void MinxCPU_Write(uint32_t addr, uint8_t data)
+{
+	uint8_t *page;
+	if (MinxCPU_IdleSkip) MinxCPU_Writes++;
+	if (addr < 0x200000) {
+		page = MinxCPU_WritePage[addr >> MINX_PAGE_SHIFT];
+		if (page) {
+			// Only RAM is mapped for writing
+			page[addr & MINX_PAGE_MASK] = data;
+			MinxCPU_MarkRAM(addr);
+			return;
+		}
+	}
+	MinxCPU_OnWrite(1, addr, data);
+}
+
 static INLINE uint16_t ReadMem16(uint32_t addr)
 {
-	return MinxCPU_OnRead(1, addr) + (MinxCPU_OnRead(1, addr+1) << 8);
+	return MinxCPU_Read(addr) + (MinxCPU_Read(addr+1) << 8);
 }
 
 static INLINE void WriteMem16(uint32_t addr, uint16_t data)
 {
-	MinxCPU_OnWrite(1, addr, (uint8_t)data);
-	MinxCPU_OnWrite(1, addr+1, data >> 8);
+	MinxCPU_Write(addr, (uint8_t)data);
+	MinxCPU_Write(addr+1, data >> 8);
 }
 
 static INLINE uint8_t Fetch8(void)
 {
 	if (MinxCPU.PC.W.L & 0x8000) {
 		// Banked area
-		MinxCPU.IR = MinxCPU_OnRead(1, (MinxCPU.PC.W.L++ & 0x7FFF) | (MinxCPU.PC.B.I << 15));
+		MinxCPU.IR = MinxCPU_Read((MinxCPU.PC.W.L++ & 0x7FFF) | (MinxCPU.PC.B.I << 15));
 	} else {
 		// Unbanked area
-		MinxCPU.IR = MinxCPU_OnRead(1, MinxCPU.PC.W.L++);
+		MinxCPU.IR = MinxCPU_Read(MinxCPU.PC.W.L++);
 	}
 	return MinxCPU.IR;
 }
@@ -175,6 +291,10 @@ int MinxCPU_ExecSPCF(void);
 
 // Instructions Macros
 
+#ifdef MINX_NOBRANCH
+#include "MinxCPU_noBranch.h"
+#else
+
 static INLINE uint8_t ADD8(uint8_t A, uint8_t B)
 {
 	register uint8_t RES;
@@ -448,16 +568,18 @@ static INLINE uint16_t DEC16(uint16_t A)
 	return A;
 }
 
+#endif
+
 static INLINE void PUSH(uint8_t A)
 {
 	MinxCPU.SP.W.L--;
-	MinxCPU_OnWrite(1, MinxCPU.SP.D, A);
+	MinxCPU_Write(MinxCPU.SP.D, A);
 }
 
 static INLINE uint8_t POP(void)
 {
 	register uint8_t data;
-	data = MinxCPU_OnRead(1, MinxCPU.SP.D);
+	data = MinxCPU_Read(MinxCPU.SP.D);
 	MinxCPU.SP.W.L++;
 	return data;
 }
@@ -560,6 +682,24 @@ static INLINE void JMPI(uint16_t ADDR)
 	MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
 }
 
+static INLINE void HALT(void)
+{
+	MinxCPU.Status = MINX_STATUS_HALT;
+}
+
+static INLINE void STOP(void)
+{
+	MinxCPU.Status = MINX_STATUS_STOP;
+}
+
+// CPU waiting on HALT or STOP, nothing runs until the next IRQ
+static INLINE int MinxCPU_Halted(void)
+{
+	return ((MinxCPU.Status == MINX_STATUS_HALT) || (MinxCPU.Status == MINX_STATUS_STOP)) && !MinxCPU.Shift_U;
+}
+
+#ifndef MINX_NOBRANCH
+
 static INLINE uint8_t SAL(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
@@ -662,16 +802,6 @@ static INLINE uint8_t NEG(uint8_t A)
 	return A;
 }
 
-static INLINE void HALT(void)
-{
-	MinxCPU.Status = MINX_STATUS_HALT;
-}
-
-static INLINE void STOP(void)
-{
-	MinxCPU.Status = MINX_STATUS_STOP;
-}
-
 static INLINE void MUL(void)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
@@ -696,3 +826,5 @@ static INLINE void DIV(void)
 }
 
 #endif
+
+#endif
@@ -18,6 +18,7 @@
 
 // Note: Any write to MinxCPU.HL.B.I needs to be reflected into MinxCPU.N.B.I
 
+#ifndef MINX_THREADED_BODY
 #include "PokeMini.h"
 #include "MinxCPU.h"
 
@@ -31,458 +32,459 @@ int MinxCPU_ExecCF(void)
 
 	// Process instruction
 	switch(MinxCPU.IR) {
-		case 0x00: // ADD BA, BA
+#endif
+		MINX_OP(CF, 0x00): // ADD BA, BA
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x01: // ADD BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x01): // ADD BA, HL
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x02: // ADD BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x02): // ADD BA, X
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x03: // ADD BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x03): // ADD BA, Y
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x04: // ADC BA, BA
+		MINX_OP(CF, 0x04): // ADC BA, BA
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x05: // ADC BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x05): // ADC BA, HL
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x06: // ADC BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x06): // ADC BA, X
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x07: // ADC BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x07): // ADC BA, Y
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x08: // SUB BA, BA
+		MINX_OP(CF, 0x08): // SUB BA, BA
 			MinxCPU.BA.W.L = SUB16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x09: // SUB BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x09): // SUB BA, HL
 			MinxCPU.BA.W.L = SUB16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x0A: // SUB BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x0A): // SUB BA, X
 			MinxCPU.BA.W.L = SUB16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x0B: // SUB BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x0B): // SUB BA, Y
 			MinxCPU.BA.W.L = SUB16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x0C: // SBC BA, BA
+		MINX_OP(CF, 0x0C): // SBC BA, BA
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x0D: // SBC BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x0D): // SBC BA, HL
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x0E: // SBC BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x0E): // SBC BA, X
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x0F: // SBC BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x0F): // SBC BA, Y
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x10: // *ADD BA, BA
+		MINX_OP(CF, 0x10): // *ADD BA, BA
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x11: // *ADD BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x11): // *ADD BA, HL
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x12: // *ADD BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x12): // *ADD BA, X
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x13: // *ADD BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x13): // *ADD BA, Y
 			MinxCPU.BA.W.L = ADD16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x14: // *ADC BA, BA
+		MINX_OP(CF, 0x14): // *ADC BA, BA
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x15: // *ADC BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x15): // *ADC BA, HL
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x16: // *ADC BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x16): // *ADC BA, X
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x17: // *ADC BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x17): // *ADC BA, Y
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x18: // CMP BA, BA
+		MINX_OP(CF, 0x18): // CMP BA, BA
 			SUB16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x19: // CMP BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x19): // CMP BA, HL
 			SUB16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x1A: // CMP BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x1A): // CMP BA, X
 			SUB16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x1B: // CMP BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x1B): // CMP BA, Y
 			SUB16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x1C: // *SBC BA, BA
+		MINX_OP(CF, 0x1C): // *SBC BA, BA
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x1D: // *SBC BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x1D): // *SBC BA, HL
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x1E: // *SBC BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x1E): // *SBC BA, X
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x1F: // *SBC BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x1F): // *SBC BA, Y
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x20: // ADD HL, BA
+		MINX_OP(CF, 0x20): // ADD HL, BA
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x21: // ADD HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x21): // ADD HL, HL
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x22: // ADD HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x22): // ADD HL, X
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x23: // ADD HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x23): // ADD HL, Y
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x24: // ADC HL, BA
+		MINX_OP(CF, 0x24): // ADC HL, BA
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x25: // ADC HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x25): // ADC HL, HL
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x26: // ADC HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x26): // ADC HL, X
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x27: // ADC HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x27): // ADC HL, Y
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x28: // SUB HL, BA
+		MINX_OP(CF, 0x28): // SUB HL, BA
 			MinxCPU.HL.W.L = SUB16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x29: // SUB HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x29): // SUB HL, HL
 			MinxCPU.HL.W.L = SUB16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x2A: // SUB HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x2A): // SUB HL, X
 			MinxCPU.HL.W.L = SUB16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x2B: // SUB HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x2B): // SUB HL, Y
 			MinxCPU.HL.W.L = SUB16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x2C: // SBC HL, BA
+		MINX_OP(CF, 0x2C): // SBC HL, BA
 			MinxCPU.HL.W.L = SBC16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x2D: // SBC HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x2D): // SBC HL, HL
 			MinxCPU.HL.W.L = SBC16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x2E: // SBC HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x2E): // SBC HL, X
 			MinxCPU.HL.W.L = SBC16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x2F: // SBC HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x2F): // SBC HL, Y
 			MinxCPU.HL.W.L = SBC16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x30: // *ADD HL, BA
+		MINX_OP(CF, 0x30): // *ADD HL, BA
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x31: // *ADD BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x31): // *ADD BA, HL
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x32: // *ADD BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x32): // *ADD BA, X
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x33: // *ADD BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x33): // *ADD BA, Y
 			MinxCPU.HL.W.L = ADD16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x34: // *ADC HL, BA
+		MINX_OP(CF, 0x34): // *ADC HL, BA
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x35: // *ADC HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x35): // *ADC HL, HL
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x36: // *ADC HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x36): // *ADC HL, X
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x37: // *ADC HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x37): // *ADC HL, Y
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x38: // CMP HL, BA
+		MINX_OP(CF, 0x38): // CMP HL, BA
 			SUB16(MinxCPU.HL.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x39: // CMP HL, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x39): // CMP HL, HL
 			SUB16(MinxCPU.HL.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x3A: // CMP HL, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x3A): // CMP HL, X
 			SUB16(MinxCPU.HL.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x3B: // CMP HL, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x3B): // CMP HL, Y
 			SUB16(MinxCPU.HL.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x3C: // *SBC BA, BA
+		MINX_OP(CF, 0x3C): // *SBC BA, BA
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x3D: // *SBC BA, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x3D): // *SBC BA, HL
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x3E: // *SBC BA, X
+			MINX_RET(16);
+		MINX_OP(CF, 0x3E): // *SBC BA, X
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.X.W.L);
-			return 16;
-		case 0x3F: // *SBC BA, Y
+			MINX_RET(16);
+		MINX_OP(CF, 0x3F): // *SBC BA, Y
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, MinxCPU.Y.W.L);
-			return 16;
+			MINX_RET(16);
 
-		case 0x40: // ADD X, BA
+		MINX_OP(CF, 0x40): // ADD X, BA
 			MinxCPU.X.W.L = ADD16(MinxCPU.X.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x41: // ADD X, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x41): // ADD X, HL
 			MinxCPU.X.W.L = ADD16(MinxCPU.X.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x42: // ADD Y, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x42): // ADD Y, BA
 			MinxCPU.Y.W.L = ADD16(MinxCPU.Y.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x43: // ADD Y, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x43): // ADD Y, HL
 			MinxCPU.Y.W.L = ADD16(MinxCPU.Y.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x44: // ADD SP, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x44): // ADD SP, BA
 			MinxCPU.SP.W.L = ADD16(MinxCPU.SP.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x45: // ADD SP, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x45): // ADD SP, HL
 			MinxCPU.SP.W.L = ADD16(MinxCPU.SP.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x46: // CRASH
-		case 0x47: // CRASH
-			return 16;
+			MINX_RET(16);
+		MINX_OP(CF, 0x46): // CRASH
+		MINX_OP(CF, 0x47): // CRASH
+			MINX_RET(16);
 
-		case 0x48: // SUB X, BA
+		MINX_OP(CF, 0x48): // SUB X, BA
 			MinxCPU.X.W.L = SUB16(MinxCPU.X.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x49: // SUB X, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x49): // SUB X, HL
 			MinxCPU.X.W.L = SUB16(MinxCPU.X.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x4A: // SUB Y, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x4A): // SUB Y, BA
 			MinxCPU.Y.W.L = SUB16(MinxCPU.Y.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x4B: // SUB Y, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x4B): // SUB Y, HL
 			MinxCPU.Y.W.L = SUB16(MinxCPU.Y.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x4C: // SUB SP, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x4C): // SUB SP, BA
 			MinxCPU.SP.W.L = SUB16(MinxCPU.SP.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x4D: // SUB SP, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x4D): // SUB SP, HL
 			MinxCPU.SP.W.L = SUB16(MinxCPU.SP.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x4E: // CRASH
-		case 0x4F: // CRASH
-			return 16;
+			MINX_RET(16);
+		MINX_OP(CF, 0x4E): // CRASH
+		MINX_OP(CF, 0x4F): // CRASH
+			MINX_RET(16);
 
-		case 0x50: // *ADD X, BA
+		MINX_OP(CF, 0x50): // *ADD X, BA
 			MinxCPU.X.W.L = ADD16(MinxCPU.X.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x51: // *ADD X, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x51): // *ADD X, HL
 			MinxCPU.X.W.L = ADD16(MinxCPU.X.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x52: // *ADD Y, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x52): // *ADD Y, BA
 			MinxCPU.Y.W.L = ADD16(MinxCPU.Y.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x53: // *ADD Y, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x53): // *ADD Y, HL
 			MinxCPU.Y.W.L = ADD16(MinxCPU.Y.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x54: // *ADD SP, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x54): // *ADD SP, BA
 			MinxCPU.SP.W.L = ADD16(MinxCPU.SP.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x55: // *ADD SP, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x55): // *ADD SP, HL
 			MinxCPU.SP.W.L = ADD16(MinxCPU.SP.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x56: // CRASH
-		case 0x57: // CRASH
-			return 16;
+			MINX_RET(16);
+		MINX_OP(CF, 0x56): // CRASH
+		MINX_OP(CF, 0x57): // CRASH
+			MINX_RET(16);
 
-		case 0x58: // *SUB X, BA
+		MINX_OP(CF, 0x58): // *SUB X, BA
 			MinxCPU.X.W.L = SUB16(MinxCPU.X.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x59: // *SUB X, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x59): // *SUB X, HL
 			MinxCPU.X.W.L = SUB16(MinxCPU.X.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x5A: // *SUB Y, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x5A): // *SUB Y, BA
 			MinxCPU.Y.W.L = SUB16(MinxCPU.Y.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x5B: // *SUB Y, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x5B): // *SUB Y, HL
 			MinxCPU.Y.W.L = SUB16(MinxCPU.Y.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x5C: // CMP SP, BA
+			MINX_RET(16);
+		MINX_OP(CF, 0x5C): // CMP SP, BA
 			SUB16(MinxCPU.SP.W.L, MinxCPU.BA.W.L);
-			return 16;
-		case 0x5D: // CMP SP, HL
+			MINX_RET(16);
+		MINX_OP(CF, 0x5D): // CMP SP, HL
 			SUB16(MinxCPU.SP.W.L, MinxCPU.HL.W.L);
-			return 16;
-		case 0x5E: // CRASH
-		case 0x5F: // CRASH
-			return 16;
+			MINX_RET(16);
+		MINX_OP(CF, 0x5E): // CRASH
+		MINX_OP(CF, 0x5F): // CRASH
+			MINX_RET(16);
 
-		case 0x60: // ADC BA, #nnnn
+		MINX_OP(CF, 0x60): // ADC BA, #nnnn
 			I16 = Fetch16();
 			MinxCPU.BA.W.L = ADC16(MinxCPU.BA.W.L, I16);
-			return 16;
-		case 0x61: // ADC HL, #nnnn
+			MINX_RET(16);
+		MINX_OP(CF, 0x61): // ADC HL, #nnnn
 			I16 = Fetch16();
 			MinxCPU.HL.W.L = ADC16(MinxCPU.HL.W.L, I16);
-			return 16;
-		case 0x62: // SBC BA, #nnnn
+			MINX_RET(16);
+		MINX_OP(CF, 0x62): // SBC BA, #nnnn
 			I16 = Fetch16();
 			MinxCPU.BA.W.L = SBC16(MinxCPU.BA.W.L, I16);
-			return 16;
-		case 0x63: // SBC HL, #nnnn
+			MINX_RET(16);
+		MINX_OP(CF, 0x63): // SBC HL, #nnnn
 			I16 = Fetch16();
 			MinxCPU.HL.W.L = SBC16(MinxCPU.HL.W.L, I16);
-			return 16;
+			MINX_RET(16);
 
-		case 0x64: // UNSTABLE
-		case 0x65: // UNSTABLE
-		case 0x66: // UNSTABLE
-		case 0x67: // UNSTABLE
-			return 16;
+		MINX_OP(CF, 0x64): // UNSTABLE
+		MINX_OP(CF, 0x65): // UNSTABLE
+		MINX_OP(CF, 0x66): // UNSTABLE
+		MINX_OP(CF, 0x67): // UNSTABLE
+			MINX_RET(16);
 
-		case 0x68: // ADD SP, #nnnn
+		MINX_OP(CF, 0x68): // ADD SP, #nnnn
 			I16 = Fetch16();
 			MinxCPU.SP.W.L = ADD16(MinxCPU.SP.W.L, I16);
-			return 16;
+			MINX_RET(16);
 
-		case 0x6A: // SUB SP, #nnnn
+		MINX_OP(CF, 0x6A): // SUB SP, #nnnn
 			I16 = Fetch16();
 			MinxCPU.SP.W.L = SUB16(MinxCPU.SP.W.L, I16);
-			return 16;
-		case 0x69: // UNSTABLE
-		case 0x6B: // UNSTABLE
-		case 0x6D: // UNSTABLE
-		case 0x6F: // UNSTABLE
-			return 16;
-
-		case 0x6C: // CMP SP, #nnnn
+			MINX_RET(16);
+		MINX_OP(CF, 0x69): // UNSTABLE
+		MINX_OP(CF, 0x6B): // UNSTABLE
+		MINX_OP(CF, 0x6D): // UNSTABLE
+		MINX_OP(CF, 0x6F): // UNSTABLE
+			MINX_RET(16);
+
+		MINX_OP(CF, 0x6C): // CMP SP, #nnnn
 			I16 = Fetch16();
 			SUB16(MinxCPU.SP.W.L, I16);
-			return 16;
+			MINX_RET(16);
 
-		case 0x6E: // MOV SP, #nnnn
+		MINX_OP(CF, 0x6E): // MOV SP, #nnnn
 			I16 = Fetch16();
 			MinxCPU.SP.W.L = I16;
-			return 16;
+			MINX_RET(16);
 
-		case 0x70: // MOV BA, [SP+#ss]
+		MINX_OP(CF, 0x70): // MOV BA, [SP+#ss]
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU.BA.B.L = MinxCPU_OnRead(1, I16++);
-			MinxCPU.BA.B.H = MinxCPU_OnRead(1, I16);
-			return 24;
-		case 0x71: // MOV HL, [SP+#ss]
+			MinxCPU.BA.B.L = MinxCPU_Read(I16++);
+			MinxCPU.BA.B.H = MinxCPU_Read(I16);
+			MINX_RET(24);
+		MINX_OP(CF, 0x71): // MOV HL, [SP+#ss]
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU.HL.B.L = MinxCPU_OnRead(1, I16++);
-			MinxCPU.HL.B.H = MinxCPU_OnRead(1, I16);
-			return 24;
-		case 0x72: // MOV X, [SP+#ss]
+			MinxCPU.HL.B.L = MinxCPU_Read(I16++);
+			MinxCPU.HL.B.H = MinxCPU_Read(I16);
+			MINX_RET(24);
+		MINX_OP(CF, 0x72): // MOV X, [SP+#ss]
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU.X.B.L = MinxCPU_OnRead(1, I16++);
-			MinxCPU.X.B.H = MinxCPU_OnRead(1, I16);
-			return 24;
-		case 0x73: // MOV Y, [SP+#ss]
+			MinxCPU.X.B.L = MinxCPU_Read(I16++);
+			MinxCPU.X.B.H = MinxCPU_Read(I16);
+			MINX_RET(24);
+		MINX_OP(CF, 0x73): // MOV Y, [SP+#ss]
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU.Y.B.L = MinxCPU_OnRead(1, I16++);
-			MinxCPU.Y.B.H = MinxCPU_OnRead(1, I16);
-			return 24;
+			MinxCPU.Y.B.L = MinxCPU_Read(I16++);
+			MinxCPU.Y.B.H = MinxCPU_Read(I16);
+			MINX_RET(24);
 
-		case 0x74: // MOV [SP+#ss], BA
+		MINX_OP(CF, 0x74): // MOV [SP+#ss], BA
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU_OnWrite(1, I16++, MinxCPU.BA.B.L);
-			MinxCPU_OnWrite(1, I16, MinxCPU.BA.B.H);
-			return 24;
-		case 0x75: // MOV [SP+#ss], HL
+			MinxCPU_Write(I16++, MinxCPU.BA.B.L);
+			MinxCPU_Write(I16, MinxCPU.BA.B.H);
+			MINX_RET(24);
+		MINX_OP(CF, 0x75): // MOV [SP+#ss], HL
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU_OnWrite(1, I16++, MinxCPU.HL.B.L);
-			MinxCPU_OnWrite(1, I16, MinxCPU.HL.B.H);
-			return 24;
-		case 0x76: // MOV [SP+#ss], X
+			MinxCPU_Write(I16++, MinxCPU.HL.B.L);
+			MinxCPU_Write(I16, MinxCPU.HL.B.H);
+			MINX_RET(24);
+		MINX_OP(CF, 0x76): // MOV [SP+#ss], X
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU_OnWrite(1, I16++, MinxCPU.X.B.L);
-			MinxCPU_OnWrite(1, I16, MinxCPU.X.B.H);
-			return 24;
-		case 0x77: // MOV [SP+#ss], Y
+			MinxCPU_Write(I16++, MinxCPU.X.B.L);
+			MinxCPU_Write(I16, MinxCPU.X.B.H);
+			MINX_RET(24);
+		MINX_OP(CF, 0x77): // MOV [SP+#ss], Y
 			I8A = Fetch8();
 			I16 = MinxCPU.SP.W.L + S8_TO_16(I8A);
-			MinxCPU_OnWrite(1, I16++, MinxCPU.Y.B.L);
-			MinxCPU_OnWrite(1, I16, MinxCPU.Y.B.H);
-			return 24;
+			MinxCPU_Write(I16++, MinxCPU.Y.B.L);
+			MinxCPU_Write(I16, MinxCPU.Y.B.H);
+			MINX_RET(24);
 
-		case 0x78: // MOV SP, [#nnnn]
+		MINX_OP(CF, 0x78): // MOV SP, [#nnnn]
 			I16 = Fetch16();
-			MinxCPU.SP.B.L = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16++);
-			MinxCPU.SP.B.H = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16);
-			return 24;
+			MinxCPU.SP.B.L = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16++);
+			MinxCPU.SP.B.H = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16);
+			MINX_RET(24);
 
-		case 0x79: // ??? #nn
-		case 0x7A: // ??? #nn
-		case 0x7B: // ??? #nn
-			return MinxCPU_ExecSPCF();
+		MINX_OP(CF, 0x79): // ??? #nn
+		MINX_OP(CF, 0x7A): // ??? #nn
+		MINX_OP(CF, 0x7B): // ??? #nn
+			MINX_RET(MinxCPU_ExecSPCF());
 
-		case 0x7C: // MOV [#nnnn], SP
+		MINX_OP(CF, 0x7C): // MOV [#nnnn], SP
 			I16 = Fetch16();
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16++, MinxCPU.SP.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16, MinxCPU.SP.B.H);
-			return 24;
-
-		case 0x7D: case 0x7E: case 0x7F: // ??? #nn
-		case 0x80: case 0x81: case 0x82: case 0x83:
-		case 0x84: case 0x85: case 0x86: case 0x87:
-		case 0x88: case 0x89: case 0x8A: case 0x8B:
-		case 0x8C: case 0x8D: case 0x8E: case 0x8F:
-		case 0x90: case 0x91: case 0x92: case 0x93:
-		case 0x94: case 0x95: case 0x96: case 0x97:
-		case 0x98: case 0x99: case 0x9A: case 0x9B:
-		case 0x9C: case 0x9D: case 0x9E: case 0x9F:
-		case 0xA0: case 0xA1: case 0xA2: case 0xA3:
-		case 0xA4: case 0xA5: case 0xA6: case 0xA7:
-		case 0xA8: case 0xA9: case 0xAA: case 0xAB:
-		case 0xAC: case 0xAD: case 0xAE: case 0xAF:
-			return MinxCPU_ExecSPCF();
-
-		case 0xB0: // PUSH A
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16++, MinxCPU.SP.B.L);
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16, MinxCPU.SP.B.H);
+			MINX_RET(24);
+
+		MINX_OP(CF, 0x7D): MINX_OP(CF, 0x7E): MINX_OP(CF, 0x7F): // ??? #nn
+		MINX_OP(CF, 0x80): MINX_OP(CF, 0x81): MINX_OP(CF, 0x82): MINX_OP(CF, 0x83):
+		MINX_OP(CF, 0x84): MINX_OP(CF, 0x85): MINX_OP(CF, 0x86): MINX_OP(CF, 0x87):
+		MINX_OP(CF, 0x88): MINX_OP(CF, 0x89): MINX_OP(CF, 0x8A): MINX_OP(CF, 0x8B):
+		MINX_OP(CF, 0x8C): MINX_OP(CF, 0x8D): MINX_OP(CF, 0x8E): MINX_OP(CF, 0x8F):
+		MINX_OP(CF, 0x90): MINX_OP(CF, 0x91): MINX_OP(CF, 0x92): MINX_OP(CF, 0x93):
+		MINX_OP(CF, 0x94): MINX_OP(CF, 0x95): MINX_OP(CF, 0x96): MINX_OP(CF, 0x97):
+		MINX_OP(CF, 0x98): MINX_OP(CF, 0x99): MINX_OP(CF, 0x9A): MINX_OP(CF, 0x9B):
+		MINX_OP(CF, 0x9C): MINX_OP(CF, 0x9D): MINX_OP(CF, 0x9E): MINX_OP(CF, 0x9F):
+		MINX_OP(CF, 0xA0): MINX_OP(CF, 0xA1): MINX_OP(CF, 0xA2): MINX_OP(CF, 0xA3):
+		MINX_OP(CF, 0xA4): MINX_OP(CF, 0xA5): MINX_OP(CF, 0xA6): MINX_OP(CF, 0xA7):
+		MINX_OP(CF, 0xA8): MINX_OP(CF, 0xA9): MINX_OP(CF, 0xAA): MINX_OP(CF, 0xAB):
+		MINX_OP(CF, 0xAC): MINX_OP(CF, 0xAD): MINX_OP(CF, 0xAE): MINX_OP(CF, 0xAF):
+			MINX_RET(MinxCPU_ExecSPCF());
+
+		MINX_OP(CF, 0xB0): // PUSH A
 			PUSH(MinxCPU.BA.B.L);
-			return 12;
-		case 0xB1: // PUSH B
+			MINX_RET(12);
+		MINX_OP(CF, 0xB1): // PUSH B
 			PUSH(MinxCPU.BA.B.H);
-			return 12;
-		case 0xB2: // PUSH L
+			MINX_RET(12);
+		MINX_OP(CF, 0xB2): // PUSH L
 			PUSH(MinxCPU.HL.B.L);
-			return 12;
-		case 0xB3: // PUSH H
+			MINX_RET(12);
+		MINX_OP(CF, 0xB3): // PUSH H
 			PUSH(MinxCPU.HL.B.H);
-			return 12;
+			MINX_RET(12);
 
-		case 0xB4: // POP A
+		MINX_OP(CF, 0xB4): // POP A
 			MinxCPU.BA.B.L = POP();
-			return 12;
-		case 0xB5: // POP B
+			MINX_RET(12);
+		MINX_OP(CF, 0xB5): // POP B
 			MinxCPU.BA.B.H = POP();
-			return 12;
-		case 0xB6: // POP L
+			MINX_RET(12);
+		MINX_OP(CF, 0xB6): // POP L
 			MinxCPU.HL.B.L = POP();
-			return 12;
-		case 0xB7: // POP H
+			MINX_RET(12);
+		MINX_OP(CF, 0xB7): // POP H
 			MinxCPU.HL.B.H = POP();
-			return 12;
-		case 0xB8: // PUSHA
+			MINX_RET(12);
+		MINX_OP(CF, 0xB8): // PUSHA
 			PUSH(MinxCPU.BA.B.H);
 			PUSH(MinxCPU.BA.B.L);
 			PUSH(MinxCPU.HL.B.H);
@@ -492,8 +494,8 @@ int MinxCPU_ExecCF(void)
 			PUSH(MinxCPU.Y.B.H);
 			PUSH(MinxCPU.Y.B.L);
 			PUSH(MinxCPU.N.B.H);
-			return 48;
-		case 0xB9: // PUSHAX
+			MINX_RET(48);
+		MINX_OP(CF, 0xB9): // PUSHAX
 			PUSH(MinxCPU.BA.B.H);
 			PUSH(MinxCPU.BA.B.L);
 			PUSH(MinxCPU.HL.B.H);
@@ -506,12 +508,12 @@ int MinxCPU_ExecCF(void)
 			PUSH(MinxCPU.HL.B.I);
 			PUSH(MinxCPU.X.B.I);
 			PUSH(MinxCPU.Y.B.I);
-			return 60;
+			MINX_RET(60);
 
-		case 0xBA: case 0xBB: // ??? #n
-			return MinxCPU_ExecSPCF();
+		MINX_OP(CF, 0xBA): MINX_OP(CF, 0xBB): // ??? #n
+			MINX_RET(MinxCPU_ExecSPCF());
 
-		case 0xBC: // POPA
+		MINX_OP(CF, 0xBC): // POPA
 			MinxCPU.N.B.H = POP();
 			MinxCPU.Y.B.L = POP();
 			MinxCPU.Y.B.H = POP();
@@ -521,9 +523,9 @@ int MinxCPU_ExecCF(void)
 			MinxCPU.HL.B.H = POP();
 			MinxCPU.BA.B.L = POP();
 			MinxCPU.BA.B.H = POP();
-			return 44;
+			MINX_RET(44);
 
-		case 0xBD: // POPAX
+		MINX_OP(CF, 0xBD): // POPAX
 			MinxCPU.Y.B.I = POP();
 			MinxCPU.X.B.I = POP();
 			MinxCPU.HL.B.I = POP();
@@ -537,244 +539,246 @@ int MinxCPU_ExecCF(void)
 			MinxCPU.HL.B.H = POP();
 			MinxCPU.BA.B.L = POP();
 			MinxCPU.BA.B.H = POP();
-			return 56;
+			MINX_RET(56);
 
-		case 0xBE: case 0xBF: // ??? #n
-			return MinxCPU_ExecSPCF();
+		MINX_OP(CF, 0xBE): MINX_OP(CF, 0xBF): // ??? #n
+			MINX_RET(MinxCPU_ExecSPCF());
 
-		case 0xC0: // MOV BA, [HL]
+		MINX_OP(CF, 0xC0): // MOV BA, [HL]
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU.BA.B.L = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16++);
-			MinxCPU.BA.B.H = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16);
-			return 20;
-		case 0xC1: // MOV HL, [HL]
+			MinxCPU.BA.B.L = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16++);
+			MinxCPU.BA.B.H = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC1): // MOV HL, [HL]
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU.HL.B.L = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16++);
-			MinxCPU.HL.B.H = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16);
-			return 20;
-		case 0xC2: // MOV X, [HL]
+			MinxCPU.HL.B.L = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16++);
+			MinxCPU.HL.B.H = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC2): // MOV X, [HL]
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU.X.B.L = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16++);
-			MinxCPU.X.B.H = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16);
-			return 20;
-		case 0xC3: // MOV Y, [HL]
+			MinxCPU.X.B.L = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16++);
+			MinxCPU.X.B.H = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC3): // MOV Y, [HL]
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU.Y.B.L = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16++);
-			MinxCPU.Y.B.H = MinxCPU_OnRead(1, (MinxCPU.HL.B.I << 16) | I16);
-			return 20;
+			MinxCPU.Y.B.L = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16++);
+			MinxCPU.Y.B.H = MinxCPU_Read((MinxCPU.HL.B.I << 16) | I16);
+			MINX_RET(20);
 
-		case 0xC4: // MOV [HL], BA
+		MINX_OP(CF, 0xC4): // MOV [HL], BA
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16++, MinxCPU.BA.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16, MinxCPU.BA.B.H);
-			return 20;
-		case 0xC5: // MOV [HL], HL
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16++, MinxCPU.BA.B.L);
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16, MinxCPU.BA.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC5): // MOV [HL], HL
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16++, MinxCPU.HL.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16, MinxCPU.HL.B.H);
-			return 20;
-		case 0xC6: // MOV [HL], X
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16++, MinxCPU.HL.B.L);
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16, MinxCPU.HL.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC6): // MOV [HL], X
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16++, MinxCPU.X.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16, MinxCPU.X.B.H);
-			return 20;
-		case 0xC7: // MOV [HL], Y
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16++, MinxCPU.X.B.L);
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16, MinxCPU.X.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xC7): // MOV [HL], Y
 			I16 = MinxCPU.HL.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16++, MinxCPU.Y.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.HL.B.I << 16) | I16, MinxCPU.Y.B.H);
-			return 20;
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16++, MinxCPU.Y.B.L);
+			MinxCPU_Write((MinxCPU.HL.B.I << 16) | I16, MinxCPU.Y.B.H);
+			MINX_RET(20);
 
-		case 0xC8: case 0xC9: case 0xCA: case 0xCB: // MOV B, V
-		case 0xCC: case 0xCD: case 0xCE: case 0xCF:
+		MINX_OP(CF, 0xC8): MINX_OP(CF, 0xC9): MINX_OP(CF, 0xCA): MINX_OP(CF, 0xCB): // MOV B, V
+		MINX_OP(CF, 0xCC): MINX_OP(CF, 0xCD): MINX_OP(CF, 0xCE): MINX_OP(CF, 0xCF):
 			MinxCPU.BA.B.H = MinxCPU.PC.B.I;
-			return 12;
+			MINX_RET(12);
 
-		case 0xD0: // MOV BA, [X]
+		MINX_OP(CF, 0xD0): // MOV BA, [X]
 			I16 = MinxCPU.X.W.L;
-			MinxCPU.BA.B.L = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16++);
-			MinxCPU.BA.B.H = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16);
-			return 20;
-		case 0xD1: // MOV HL, [X]
+			MinxCPU.BA.B.L = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16++);
+			MinxCPU.BA.B.H = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD1): // MOV HL, [X]
 			I16 = MinxCPU.X.W.L;
-			MinxCPU.HL.B.L = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16++);
-			MinxCPU.HL.B.H = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16);
-			return 20;
-		case 0xD2: // MOV X, [X]
+			MinxCPU.HL.B.L = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16++);
+			MinxCPU.HL.B.H = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD2): // MOV X, [X]
 			I16 = MinxCPU.X.W.L;
-			MinxCPU.X.B.L = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16++);
-			MinxCPU.X.B.H = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16);
-			return 20;
-		case 0xD3: // MOV Y, [X]
+			MinxCPU.X.B.L = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16++);
+			MinxCPU.X.B.H = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD3): // MOV Y, [X]
 			I16 = MinxCPU.X.W.L;
-			MinxCPU.Y.B.L = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16++);
-			MinxCPU.Y.B.H = MinxCPU_OnRead(1, (MinxCPU.X.B.I << 16) | I16);
-			return 20;
+			MinxCPU.Y.B.L = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16++);
+			MinxCPU.Y.B.H = MinxCPU_Read((MinxCPU.X.B.I << 16) | I16);
+			MINX_RET(20);
 
-		case 0xD4: // MOV [X], BA
+		MINX_OP(CF, 0xD4): // MOV [X], BA
 			I16 = MinxCPU.X.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16++, MinxCPU.BA.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16, MinxCPU.BA.B.H);
-			return 20;
-		case 0xD5: // MOV [X], HL
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16++, MinxCPU.BA.B.L);
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16, MinxCPU.BA.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD5): // MOV [X], HL
 			I16 = MinxCPU.X.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16++, MinxCPU.HL.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16, MinxCPU.HL.B.H);
-			return 20;
-		case 0xD6: // MOV [X], X
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16++, MinxCPU.HL.B.L);
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16, MinxCPU.HL.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD6): // MOV [X], X
 			I16 = MinxCPU.X.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16++, MinxCPU.X.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16, MinxCPU.X.B.H);
-			return 20;
-		case 0xD7: // MOV [X], Y
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16++, MinxCPU.X.B.L);
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16, MinxCPU.X.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD7): // MOV [X], Y
 			I16 = MinxCPU.X.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16++, MinxCPU.Y.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.X.B.I << 16) | I16, MinxCPU.Y.B.H);
-			return 20;
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16++, MinxCPU.Y.B.L);
+			MinxCPU_Write((MinxCPU.X.B.I << 16) | I16, MinxCPU.Y.B.H);
+			MINX_RET(20);
 
-		case 0xD8: // MOV BA, [Y]
+		MINX_OP(CF, 0xD8): // MOV BA, [Y]
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU.BA.B.L = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16++);
-			MinxCPU.BA.B.H = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16);
-			return 20;
-		case 0xD9: // MOV HL, [Y]
+			MinxCPU.BA.B.L = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16++);
+			MinxCPU.BA.B.H = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xD9): // MOV HL, [Y]
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU.HL.B.L = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16++);
-			MinxCPU.HL.B.H = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16);
-			return 20;
-		case 0xDA: // MOV X, [Y]
+			MinxCPU.HL.B.L = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16++);
+			MinxCPU.HL.B.H = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xDA): // MOV X, [Y]
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU.X.B.L = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16++);
-			MinxCPU.X.B.H = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16);
-			return 20;
-		case 0xDB: // MOV Y, [Y]
+			MinxCPU.X.B.L = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16++);
+			MinxCPU.X.B.H = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16);
+			MINX_RET(20);
+		MINX_OP(CF, 0xDB): // MOV Y, [Y]
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU.Y.B.L = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16++);
-			MinxCPU.Y.B.H = MinxCPU_OnRead(1, (MinxCPU.Y.B.I << 16) | I16);
-			return 20;
+			MinxCPU.Y.B.L = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16++);
+			MinxCPU.Y.B.H = MinxCPU_Read((MinxCPU.Y.B.I << 16) | I16);
+			MINX_RET(20);
 
-		case 0xDC: // MOV [Y], BA
+		MINX_OP(CF, 0xDC): // MOV [Y], BA
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16++, MinxCPU.BA.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16, MinxCPU.BA.B.H);
-			return 20;
-		case 0xDD: // MOV [Y], HL
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16++, MinxCPU.BA.B.L);
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16, MinxCPU.BA.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xDD): // MOV [Y], HL
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16++, MinxCPU.HL.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16, MinxCPU.HL.B.H);
-			return 20;
-		case 0xDE: // MOV [Y], X
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16++, MinxCPU.HL.B.L);
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16, MinxCPU.HL.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xDE): // MOV [Y], X
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16++, MinxCPU.X.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16, MinxCPU.X.B.H);
-			return 20;
-		case 0xDF: // MOV [Y], Y
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16++, MinxCPU.X.B.L);
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16, MinxCPU.X.B.H);
+			MINX_RET(20);
+		MINX_OP(CF, 0xDF): // MOV [Y], Y
 			I16 = MinxCPU.Y.W.L;
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16++, MinxCPU.Y.B.L);
-			MinxCPU_OnWrite(1, (MinxCPU.Y.B.I << 16) | I16, MinxCPU.Y.B.H);
-			return 20;
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16++, MinxCPU.Y.B.L);
+			MinxCPU_Write((MinxCPU.Y.B.I << 16) | I16, MinxCPU.Y.B.H);
+			MINX_RET(20);
 
-		case 0xE0: // MOV BA, BA
-			return 8;
-		case 0xE1: // MOV BA, HL
+		MINX_OP(CF, 0xE0): // MOV BA, BA
+			MINX_RET(8);
+		MINX_OP(CF, 0xE1): // MOV BA, HL
 			MinxCPU.BA.W.L = MinxCPU.HL.W.L;
-			return 8;
-		case 0xE2: // MOV BA, X
+			MINX_RET(8);
+		MINX_OP(CF, 0xE2): // MOV BA, X
 			MinxCPU.BA.W.L = MinxCPU.X.W.L;
-			return 8;
-		case 0xE3: // MOV BA, Y
+			MINX_RET(8);
+		MINX_OP(CF, 0xE3): // MOV BA, Y
 			MinxCPU.BA.W.L = MinxCPU.Y.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xE4: // MOV HL, BA
+		MINX_OP(CF, 0xE4): // MOV HL, BA
 			MinxCPU.HL.W.L = MinxCPU.BA.W.L;
-			return 8;
-		case 0xE5: // MOV HL, HL
-			return 8;
-		case 0xE6: // MOV HL, X
+			MINX_RET(8);
+		MINX_OP(CF, 0xE5): // MOV HL, HL
+			MINX_RET(8);
+		MINX_OP(CF, 0xE6): // MOV HL, X
 			MinxCPU.HL.W.L = MinxCPU.X.W.L;
-			return 8;
-		case 0xE7: // MOV HL, Y
+			MINX_RET(8);
+		MINX_OP(CF, 0xE7): // MOV HL, Y
 			MinxCPU.HL.W.L = MinxCPU.Y.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xE8: // MOV X, BA
+		MINX_OP(CF, 0xE8): // MOV X, BA
 			MinxCPU.X.W.L = MinxCPU.BA.W.L;
-			return 8;
-		case 0xE9: // MOV X, HL
+			MINX_RET(8);
+		MINX_OP(CF, 0xE9): // MOV X, HL
 			MinxCPU.X.W.L = MinxCPU.HL.W.L;
-			return 8;
-		case 0xEA: // MOV X, X
-			return 8;
-		case 0xEB: // MOV X, Y
+			MINX_RET(8);
+		MINX_OP(CF, 0xEA): // MOV X, X
+			MINX_RET(8);
+		MINX_OP(CF, 0xEB): // MOV X, Y
 			MinxCPU.X.W.L = MinxCPU.Y.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xEC: // MOV Y, BA
+		MINX_OP(CF, 0xEC): // MOV Y, BA
 			MinxCPU.Y.W.L = MinxCPU.BA.W.L;
-			return 8;
-		case 0xED: // MOV Y, HL
+			MINX_RET(8);
+		MINX_OP(CF, 0xED): // MOV Y, HL
 			MinxCPU.Y.W.L = MinxCPU.HL.W.L;
-			return 8;
-		case 0xEE: // MOV Y, X
+			MINX_RET(8);
+		MINX_OP(CF, 0xEE): // MOV Y, X
 			MinxCPU.Y.W.L = MinxCPU.X.W.L;
-			return 8;
-		case 0xEF: // MOV Y, Y
-			return 8;
+			MINX_RET(8);
+		MINX_OP(CF, 0xEF): // MOV Y, Y
+			MINX_RET(8);
 
-		case 0xF0: // MOV SP, BA
+		MINX_OP(CF, 0xF0): // MOV SP, BA
 			MinxCPU.SP.W.L = MinxCPU.BA.W.L;
-			return 8;
-		case 0xF1: // MOV SP, HL
+			MINX_RET(8);
+		MINX_OP(CF, 0xF1): // MOV SP, HL
 			MinxCPU.SP.W.L = MinxCPU.HL.W.L;
-			return 8;
-		case 0xF2: // MOV SP, X
+			MINX_RET(8);
+		MINX_OP(CF, 0xF2): // MOV SP, X
 			MinxCPU.SP.W.L = MinxCPU.X.W.L;
-			return 8;
-		case 0xF3: // MOV SP, Y
+			MINX_RET(8);
+		MINX_OP(CF, 0xF3): // MOV SP, Y
 			MinxCPU.SP.W.L = MinxCPU.Y.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xF4: // MOV HL, SP
+		MINX_OP(CF, 0xF4): // MOV HL, SP
 			MinxCPU.HL.W.L = MinxCPU.SP.W.L;
-			return 8;
-		case 0xF5: // MOV HL, PC
+			MINX_RET(8);
+		MINX_OP(CF, 0xF5): // MOV HL, PC
 			MinxCPU.HL.W.L = MinxCPU.PC.W.L;
-			return 8;
-		case 0xF6: // ??? X
+			MINX_RET(8);
+		MINX_OP(CF, 0xF6): // ??? X
 			MinxCPU.X.B.H = MinxCPU.PC.B.I;
-			return 12;
-		case 0xF7: // ??? Y
+			MINX_RET(12);
+		MINX_OP(CF, 0xF7): // ??? Y
 			MinxCPU.Y.B.H = MinxCPU.PC.B.I;
-			return 12;
+			MINX_RET(12);
 
-		case 0xF8: // MOV BA, SP
+		MINX_OP(CF, 0xF8): // MOV BA, SP
 			MinxCPU.BA.W.L = MinxCPU.SP.W.L;
-			return 8;
-		case 0xF9: // MOV BA, PC
+			MINX_RET(8);
+		MINX_OP(CF, 0xF9): // MOV BA, PC
 			MinxCPU.BA.W.L = MinxCPU.PC.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xFA: // MOV X, SP
+		MINX_OP(CF, 0xFA): // MOV X, SP
 			MinxCPU.X.W.L = MinxCPU.SP.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xFB: // NOTHING
-		case 0xFC: // NOTHING
-			return 12;
-		case 0xFD: // MOV A, E
+		MINX_OP(CF, 0xFB): // NOTHING
+		MINX_OP(CF, 0xFC): // NOTHING
+			MINX_RET(12);
+		MINX_OP(CF, 0xFD): // MOV A, E
 			MinxCPU.BA.B.L = MinxCPU.E;
-			return 12;
+			MINX_RET(12);
 
-		case 0xFE: // MOV Y, SP
+		MINX_OP(CF, 0xFE): // MOV Y, SP
 			MinxCPU.Y.W.L = MinxCPU.SP.W.L;
-			return 8;
+			MINX_RET(8);
 
-		case 0xFF: // NOTHING
-			return 64;
+		MINX_OP(CF, 0xFF): // NOTHING
+			MINX_RET(64);
 
+#ifndef MINX_THREADED_BODY
 		default:
 			break;
 	}
 
 	return 4;
 }
+#endif
@@ -0,0 +1,110 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Threaded dispatch
+//
+// The opcode handlers of MinxCPU_XX.c, MinxCPU_CE.c and MinxCPU_CF.c are
+// included here a second time with MINX_THREADED_BODY defined, so every
+// case becomes a label and every return becomes a jump through the opcode
+// table, each handler having its own indirect branch. CE and CF prefixes
+// jump into their tables directly.
+
+#define MINX_THREADED_BODY
+
+#include "PokeMini.h"
+#include "MinxCPU.h"
+
+#ifdef MINX_THREADED
+
+#define MINX_OP(t, n)	op_##t##_##n
+#define MINX_RET(c)	do { ran += (c); MINX_NEXT(); } while (0)
+#define MINX_PREFIX(t)	do { MinxCPU.IR = Fetch8(); goto *Op##t[MinxCPU.IR]; } while (0)
+
+// Leave or take the slow path, otherwise dispatch next instruction
+#define MINX_NEXT() do {\
+	if ((ran >= cycles) | MinxCPU.Shift_U | (MinxCPU.Status != MINX_STATUS_NORMAL) | MinxCPU_RunBreak) goto slow;\
+	MinxCPU_RunCycles = ran;\
+	MinxCPU.IR = Fetch8();\
+	executed++;\
+	goto *OpXX[MinxCPU.IR];\
+} while (0)
+
+// Opcode table rows
+#define MINX_ROW(t, h)\
+	&&op_##t##_0x##h##0, &&op_##t##_0x##h##1, &&op_##t##_0x##h##2, &&op_##t##_0x##h##3,\
+	&&op_##t##_0x##h##4, &&op_##t##_0x##h##5, &&op_##t##_0x##h##6, &&op_##t##_0x##h##7,\
+	&&op_##t##_0x##h##8, &&op_##t##_0x##h##9, &&op_##t##_0x##h##A, &&op_##t##_0x##h##B,\
+	&&op_##t##_0x##h##C, &&op_##t##_0x##h##D, &&op_##t##_0x##h##E, &&op_##t##_0x##h##F
+#define MINX_TABLE(t)\
+	MINX_ROW(t, 0), MINX_ROW(t, 1), MINX_ROW(t, 2), MINX_ROW(t, 3),\
+	MINX_ROW(t, 4), MINX_ROW(t, 5), MINX_ROW(t, 6), MINX_ROW(t, 7),\
+	MINX_ROW(t, 8), MINX_ROW(t, 9), MINX_ROW(t, A), MINX_ROW(t, B),\
+	MINX_ROW(t, C), MINX_ROW(t, D), MINX_ROW(t, E), MINX_ROW(t, F)
+
+int MinxCPU_ExecThreaded(int cycles)
+{
+	static const void *OpXX[256] = { MINX_TABLE(XX) };
+	static const void *OpCE[256] = { MINX_TABLE(CE) };
+	static const void *OpCF[256] = { MINX_TABLE(CF) };
+	uint8_t I8A, I8B;
+	uint16_t I16;
+	uint32_t executed = 0;
+	int ran = 0;
+
+slow:
+	if ((ran >= cycles) || MinxCPU_RunBreak) {
+		MinxCPU_Executed += executed;
+		return ran;
+	}
+	MinxCPU_RunCycles = ran;
+
+	// Shift U
+	if (MinxCPU.Shift_U) {
+		MinxCPU.U1 = MinxCPU.U2;
+		MinxCPU.U2 = MinxCPU.PC.B.I;
+		MinxCPU.Shift_U--;
+		MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
+	}
+
+	// Check HALT or STOP status
+	if (MinxCPU.Status != MINX_STATUS_NORMAL) {
+		executed++;
+		if (MinxCPU.Status == MINX_STATUS_IRQ) {
+			MinxCPU.Status = MINX_STATUS_NORMAL;	// Return to normal
+			CALLI(MinxCPU.IRQ_Vector);		// Jump to IRQ vector
+			ran += 20;
+		} else {
+			ran += 8;				// Cause short NOPs
+		}
+		goto slow;
+	}
+
+	// Read IR
+	MinxCPU.IR = Fetch8();
+	executed++;
+	goto *OpXX[MinxCPU.IR];
+
+	// Opcode handlers
+	{
+#include "MinxCPU_XX.c"
+#include "MinxCPU_CE.c"
+#include "MinxCPU_CF.c"
+	}
+}
+
+#endif
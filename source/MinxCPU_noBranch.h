@@ -16,57 +16,14 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#ifndef MINXCPU_CORE
-#define MINXCPU_CORE
-
-#include <stdint.h>
-#include <retro_inline.h>
-
-/* For some reason, '_BIG_ENDIAN' is always defined when
- * building for 3DS/Switch with devkitarm/a64... */
-#if defined (_BIG_ENDIAN) && !defined (_3DS) && !defined(HAVE_LIBNX)
-
-typedef union {
-	struct {
-		uint8_t X;
-		uint8_t I;
-		uint8_t H;
-		uint8_t L;
-	} B;
-	struct {
-		uint16_t H;
-		uint16_t L;
-	} W;
-	uint32_t D;
-} MinxRegx;
-
-#else
-
-typedef union {
-	struct {
-		uint8_t L;
-		uint8_t H;
-		uint8_t I;
-		uint8_t X;
-	} B;
-	struct {
-		uint16_t L;
-		uint16_t H;
-	} W;
-	uint32_t D;
-} MinxRegx;
-
-#endif
-
-#define MINX_FLAG_ZERO    	0x01
-#define MINX_FLAG_CARRY   	0x02
-#define MINX_FLAG_OVERFLOW	0x04
-#define MINX_FLAG_SIGN    	0x08
-#define MINX_FLAG_BCD     	0x10
-#define MINX_FLAG_NIBBLE  	0x20
-#define MINX_FLAG_INTFLG  	0x40
-#define MINX_FLAG_INTOFF  	0x80
-
+// Branch-free ALU helpers (build with MINX_NOBRANCH=1)
+//   Drop-in replacement for the flag computing instructions macros in
+//   MinxCPU.h, flags are built with shifts and masks instead of
+//   conditional jumps. Included by MinxCPU.h, not meant for direct use
+#ifndef MINXCPU_NOBRANCH
+#define MINXCPU_NOBRANCH
+
+// Shifts to move sign/overflow bits into the flags position
 #define MINX_FLAG_SIGN_S4	0
 #define MINX_FLAG_OVER_S4	1
 #define MINX_FLAG_SIGN_S8	4
@@ -74,108 +31,6 @@ typedef union {
 #define MINX_FLAG_SIGN_S16	12
 #define MINX_FLAG_OVER_S16	13
 
-#define MINX_FLAG_SAVE_NUL	0xF0
-#define MINX_FLAG_SAVE_O  	0xF4
-#define MINX_FLAG_SAVE_CO 	0xF6
-#define MINX_FLAG_SAVE_COS	0xFE
-
-// Status reasons
-enum {
-	MINX_STATUS_NORMAL = 0, // Normal operation
-	MINX_STATUS_HALT   = 1,   // CPU during HALT
-	MINX_STATUS_STOP   = 2,   // CPU during STOP
-	MINX_STATUS_IRQ    = 3    // Delay caused by hardware IRQ
-};
-
-// Signed 8-Bits to 16-Bits converter
-static INLINE uint16_t S8_TO_16(int8_t a)
-{
-	return (a & 0x80) ? (0xFF00 | a) : a;
-}
-
-typedef struct {
-	// Registers
-	MinxRegx BA;			// Registers A, B
-	MinxRegx HL;			// Registers L, H, I
-	MinxRegx X;			// Registers X, XI
-	MinxRegx Y;			// Registers Y, YI
-	MinxRegx SP;			// Register SP
-	MinxRegx PC;			// Registers PC, V
-	MinxRegx N;			// for [N+#nn], I is written here too
-	uint8_t U1;			// V Shadow 1
-	uint8_t U2;			// V Shadow 2
-	uint8_t F;			// Flags
-	uint8_t E;			// Exception
-	uint8_t IR;			// Last Instruction Register (for open-bus)
-	uint8_t Shift_U;		// Shift U, set to 2 when: U modify, branch, return
-	uint8_t Status;			// CPU Status (0 = Normal, 1 = Halt, 2 = Stoped, 3 = IRQ)
-	uint8_t IRQ_Vector;		// IRQ Vector when Status is IRQ
-	uint8_t Reserved[28];		// Reserved bytes
-} TMinxCPU;
-
-// CPU registers
-extern TMinxCPU MinxCPU;
-
-// Callbacks (Must be coded by the user)
-uint8_t MinxCPU_OnRead(int cpu, uint32_t addr);
-void MinxCPU_OnWrite(int cpu, uint32_t addr, uint8_t data);
-void MinxCPU_OnIRQHandle(uint8_t flag, uint8_t shift_u);
-void MinxCPU_OnIRQAct(uint8_t intr);
-
-// Functions
-int MinxCPU_Create(void);		// Create MinxCPU
-void MinxCPU_Destroy(void);		// Destroy MinxCPU
-void MinxCPU_Reset(int hardreset);	// Reset CPU
-int MinxCPU_Exec(void);			// Execute 1 CPU instruction
-int MinxCPU_CallIRQ(uint8_t IRQ);	// Call an IRQ
-
-// Helpers
-static INLINE uint16_t ReadMem16(uint32_t addr)
-{
-	return MinxCPU_OnRead(1, addr) + (MinxCPU_OnRead(1, addr+1) << 8);
-}
-
-static INLINE void WriteMem16(uint32_t addr, uint16_t data)
-{
-	MinxCPU_OnWrite(1, addr, (uint8_t)data);
-	MinxCPU_OnWrite(1, addr+1, data >> 8);
-}
-
-static INLINE uint8_t Fetch8(void)
-{
-	if (MinxCPU.PC.W.L & 0x8000) {
-		// Banked area
-		MinxCPU.IR = MinxCPU_OnRead(1, (MinxCPU.PC.W.L++ & 0x7FFF) | (MinxCPU.PC.B.I << 15));
-	} else {
-		// Unbanked area
-		MinxCPU.IR = MinxCPU_OnRead(1, MinxCPU.PC.W.L++);
-	}
-	return MinxCPU.IR;
-}
-
-static INLINE uint16_t Fetch16(void)
-{
-	uint8_t LB = Fetch8();
-	return (Fetch8() << 8) | LB;
-}
-
-static INLINE void Set_U(uint8_t val)
-{
-	if (val != MinxCPU.U2) MinxCPU.Shift_U = 2;
-	MinxCPU.U1 = val;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
-}
-
-// Instruction exec. prototypes
-
-int MinxCPU_ExecCE(void);
-int MinxCPU_ExecCF(void);
-int MinxCPU_ExecSPCE(void);
-int MinxCPU_ExecSPCF(void);
-
-// Instructions Macros
-
 static INLINE uint8_t ADD8(uint8_t A, uint8_t B)
 {
 	register uint8_t RES;
@@ -237,7 +92,7 @@ static INLINE uint16_t ADD16(uint16_t A, uint16_t B)
 static INLINE uint8_t ADC8(uint8_t A, uint8_t B)
 {
 	register uint8_t RES;
-	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) ? 1 : 0;
+	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) >> 1;
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	switch (MinxCPU.F & 0x30) {
 	case 0x00: // Normal
@@ -283,7 +138,7 @@ static INLINE uint8_t ADC8(uint8_t A, uint8_t B)
 static INLINE uint16_t ADC16(uint16_t A, uint16_t B)
 {
 	register uint16_t RES;
-	RES = A + B + ((MinxCPU.F & MINX_FLAG_CARRY) ? 1 : 0);
+	RES = A + B + ((MinxCPU.F & MINX_FLAG_CARRY) >> 1);
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	MinxCPU.F |=
 		((RES == 0) ? MINX_FLAG_ZERO : 0) | // Zero
@@ -354,7 +209,7 @@ static INLINE uint16_t SUB16(uint16_t A, uint16_t B)
 static INLINE uint8_t SBC8(uint8_t A, uint8_t B)
 {
 	register uint8_t RES;
-	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) ? 1 : 0;
+	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) >> 1;
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	switch (MinxCPU.F & 0x30) {
 	case 0x00: // Normal
@@ -400,7 +255,7 @@ static INLINE uint8_t SBC8(uint8_t A, uint8_t B)
 static INLINE uint16_t SBC16(uint16_t A, uint16_t B)
 {
 	register uint16_t RES;
-	RES = A - B - ((MinxCPU.F & MINX_FLAG_CARRY) ? 1 : 0);
+	RES = A - B - ((MinxCPU.F & MINX_FLAG_CARRY) >> 1);
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	MinxCPU.F |=
 		((RES == 0) ? MINX_FLAG_ZERO : 0) | // Zero
@@ -414,7 +269,7 @@ static INLINE uint8_t AND8(uint8_t A, uint8_t B)
 {
 	A &= B;
 	MinxCPU.F &= MINX_FLAG_SAVE_CO;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -424,7 +279,7 @@ static INLINE uint8_t OR8(uint8_t A, uint8_t B)
 {
 	A |= B;
 	MinxCPU.F &= MINX_FLAG_SAVE_CO;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -434,7 +289,7 @@ static INLINE uint8_t XOR8(uint8_t A, uint8_t B)
 {
 	A ^= B;
 	MinxCPU.F &= MINX_FLAG_SAVE_CO;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -444,7 +299,7 @@ static INLINE uint8_t INC8(uint8_t A)
 {
 	A++;
 	MinxCPU.F &= MINX_FLAG_SAVE_COS;
-	if (A == 0) MinxCPU.F |= MINX_FLAG_ZERO;
+	MinxCPU.F |= (A == 0) ? MINX_FLAG_ZERO : 0;
 	return A;
 }
 
@@ -452,7 +307,7 @@ static INLINE uint16_t INC16(uint16_t A)
 {
 	A++;
 	MinxCPU.F &= MINX_FLAG_SAVE_COS;
-	if (A == 0) MinxCPU.F |= MINX_FLAG_ZERO;
+	MinxCPU.F |= (A == 0) ? MINX_FLAG_ZERO : 0;
 	return A;
 }
 
@@ -460,7 +315,7 @@ static INLINE uint8_t DEC8(uint8_t A)
 {
 	A--;
 	MinxCPU.F &= MINX_FLAG_SAVE_COS;
-	if (A == 0) MinxCPU.F |= MINX_FLAG_ZERO;
+	MinxCPU.F |= (A == 0) ? MINX_FLAG_ZERO : 0;
 	return A;
 }
 
@@ -468,129 +323,16 @@ static INLINE uint16_t DEC16(uint16_t A)
 {
 	A--;
 	MinxCPU.F &= MINX_FLAG_SAVE_COS;
-	if (A == 0) MinxCPU.F |= MINX_FLAG_ZERO;
+	MinxCPU.F |= (A == 0) ? MINX_FLAG_ZERO : 0;
 	return A;
 }
 
-static INLINE void PUSH(uint8_t A)
-{
-	MinxCPU.SP.W.L--;
-	MinxCPU_OnWrite(1, MinxCPU.SP.D, A);
-}
-
-static INLINE uint8_t POP(void)
-{
-	register uint8_t data;
-	data = MinxCPU_OnRead(1, MinxCPU.SP.D);
-	MinxCPU.SP.W.L++;
-	return data;
-}
-
-static INLINE void CALLS(uint16_t OFFSET)
-{
-	PUSH(MinxCPU.PC.B.I);
-	PUSH(MinxCPU.PC.B.H);
-	PUSH(MinxCPU.PC.B.L);
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = MinxCPU.PC.W.L + OFFSET - 1;
-}
-
-static INLINE void JMPS(uint16_t OFFSET)
-{
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = MinxCPU.PC.W.L + OFFSET - 1;
-}
-
-static INLINE void CALLU(uint16_t ADDR)
-{
-	PUSH(MinxCPU.PC.B.I);
-	PUSH(MinxCPU.PC.B.H);
-	PUSH(MinxCPU.PC.B.L);
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = ADDR;
-}
-
-static INLINE void JMPU(uint16_t ADDR)
-{
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = ADDR;
-}
-
-static INLINE void JDBNZ(uint16_t OFFSET)
-{
-	MinxCPU.BA.B.H = DEC8(MinxCPU.BA.B.H);
-	if (MinxCPU.BA.B.H != 0) {
-		JMPS(OFFSET);
-	}
-}
-
-static INLINE uint8_t SWAP(uint8_t A)
-{
-	return (A << 4) | (A >> 4);
-}
-
-static INLINE void RET(void)
-{
-	MinxCPU.PC.B.L = POP();
-	MinxCPU.PC.B.H = POP();
-	MinxCPU.PC.B.I = POP();
-	Set_U(MinxCPU.PC.B.I);
-}
-
-static INLINE void RETI(void)
-{
-	MinxCPU.F = POP();
-	MinxCPU.PC.B.L = POP();
-	MinxCPU.PC.B.H = POP();
-	MinxCPU.PC.B.I = POP();
-	Set_U(MinxCPU.PC.B.I);
-	MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
-}
-
-static INLINE void CALLX(uint16_t ADDR)
-{
-	PUSH(MinxCPU.PC.B.I);
-	PUSH(MinxCPU.PC.B.H);
-	PUSH(MinxCPU.PC.B.L);
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = ReadMem16((MinxCPU.HL.B.I << 16) + ADDR);
-}
-
-static INLINE void CALLI(uint16_t ADDR)
-{
-	PUSH(MinxCPU.PC.B.I);
-	PUSH(MinxCPU.PC.B.H);
-	PUSH(MinxCPU.PC.B.L);
-	PUSH(MinxCPU.F);
-	MinxCPU.F |= 0xC0;
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = ReadMem16(ADDR);
-	MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
-}
-
-static INLINE void JMPI(uint16_t ADDR)
-{
-	PUSH(MinxCPU.F);
-	MinxCPU.F |= 0xC0;
-	MinxCPU.PC.B.I = MinxCPU.U1;
-	MinxCPU.U2 = MinxCPU.U1;
-	MinxCPU.PC.W.L = ReadMem16(ADDR);
-	MinxCPU_OnIRQHandle(MinxCPU.F, MinxCPU.Shift_U);
-}
-
 static INLINE uint8_t SAL(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
-	if (A & 0x80) MinxCPU.F |= MINX_FLAG_CARRY;
-	if ((!(A & 0x40)) != (!(A & 0x80))) MinxCPU.F |= MINX_FLAG_OVERFLOW;
+	MinxCPU.F |= ((A >> 6) & MINX_FLAG_CARRY) | (((A ^ (A << 1)) & 0x80) >> MINX_FLAG_OVER_S8);
 	A = A << 1;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -599,9 +341,9 @@ static INLINE uint8_t SAL(uint8_t A)
 static INLINE uint8_t SHL(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x80) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A >> 6) & MINX_FLAG_CARRY;
 	A = A << 1;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -610,9 +352,9 @@ static INLINE uint8_t SHL(uint8_t A)
 static INLINE uint8_t SAR(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
-	if (A & 0x01) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A & 0x01) << 1;
 	A = (A & 0x80) | (A >> 1);
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -621,9 +363,9 @@ static INLINE uint8_t SAR(uint8_t A)
 static INLINE uint8_t SHR(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x01) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A & 0x01) << 1;
 	A = A >> 1;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -631,11 +373,11 @@ static INLINE uint8_t SHR(uint8_t A)
 
 static INLINE uint8_t ROLC(uint8_t A)
 {
-	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) ? 1 : 0;
+	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) >> 1;
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x80) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A >> 6) & MINX_FLAG_CARRY;
 	A = (A << 1) | CARRY;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -644,9 +386,9 @@ static INLINE uint8_t ROLC(uint8_t A)
 static INLINE uint8_t ROL(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x80) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A >> 6) & MINX_FLAG_CARRY;
 	A = (A << 1) | (A >> 7);
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -654,11 +396,11 @@ static INLINE uint8_t ROL(uint8_t A)
 
 static INLINE uint8_t RORC(uint8_t A)
 {
-	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) ? 0x80 : 0x00;
+	register uint8_t CARRY = (MinxCPU.F & MINX_FLAG_CARRY) << 6;
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x01) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A & 0x01) << 1;
 	A = (A >> 1) | CARRY;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -667,9 +409,9 @@ static INLINE uint8_t RORC(uint8_t A)
 static INLINE uint8_t ROR(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_O;
-	if (A & 0x01) MinxCPU.F |= MINX_FLAG_CARRY;
+	MinxCPU.F |= (A & 0x01) << 1;
 	A = (A >> 1) | (A << 7);
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
@@ -679,40 +421,30 @@ static INLINE uint8_t NOT(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_CO;
 	A = A ^ 0xFF;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
-	return A;	
+	return A;
 }
 
 static INLINE uint8_t NEG(uint8_t A)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	A = -A;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((A == 0) ? MINX_FLAG_ZERO : MINX_FLAG_CARRY) |
 		((A == 0x80) ? MINX_FLAG_OVERFLOW : 0) |
 		((A & 0x80) >> MINX_FLAG_SIGN_S8);
 	return A;
 }
 
-static INLINE void HALT(void)
-{
-	MinxCPU.Status = MINX_STATUS_HALT;
-}
-
-static INLINE void STOP(void)
-{
-	MinxCPU.Status = MINX_STATUS_STOP;
-}
-
 static INLINE void MUL(void)
 {
 	MinxCPU.F &= MINX_FLAG_SAVE_NUL;
 	MinxCPU.HL.W.L = (uint16_t)MinxCPU.HL.B.L * (uint16_t)MinxCPU.BA.B.L;
-	MinxCPU.F |= 
+	MinxCPU.F |=
 		((MinxCPU.HL.W.L == 0) ? MINX_FLAG_ZERO : 0) |
-		((MinxCPU.HL.W.L & 0x8000) ? MINX_FLAG_SIGN : 0);
+		((MinxCPU.HL.W.L & 0x8000) >> MINX_FLAG_SIGN_S16);
 }
 
 static INLINE void DIV(void)
@@ -725,9 +457,9 @@ static INLINE void DIV(void)
 	if (RES < 256) {
 		MinxCPU.HL.B.H = MinxCPU.HL.W.L % MinxCPU.BA.B.L;
 		MinxCPU.HL.B.L = (uint8_t)RES;
-		MinxCPU.F |= 
+		MinxCPU.F |=
 			((MinxCPU.HL.B.L == 0) ? MINX_FLAG_ZERO : 0) |
-			((MinxCPU.HL.B.L & 0x80) ? MINX_FLAG_SIGN : 0);
+			((MinxCPU.HL.B.L & 0x80) >> MINX_FLAG_SIGN_S8);
 	} else MinxCPU.F |= MINX_FLAG_OVERFLOW | MINX_FLAG_SIGN;
 }
 
@@ -22,19 +22,19 @@
 #include <gw_malloc.h>
 #endif
 
-TMinxColorPRC MinxColorPRC;
-uint8_t *PRCColorVMem = NULL;		// Complete CVRAM (16KB)
-uint8_t *PRCColorPixels = NULL;		// Active page (8KB)
-uint8_t *PRCColorPixelsOld = NULL;
-uint8_t *PRCColorMap = NULL;
-unsigned int PRCColorOffset = 0;
-uint8_t *PRCColorTop = 0x00000000;
+POKEMINI_TLS TMinxColorPRC MinxColorPRC;
+POKEMINI_TLS uint8_t *PRCColorVMem = NULL;		// Complete CVRAM (16KB)
+POKEMINI_TLS uint8_t *PRCColorPixels = NULL;		// Active page (8KB)
+POKEMINI_TLS uint8_t *PRCColorPixelsOld = NULL;
+POKEMINI_TLS uint8_t *PRCColorMap = NULL;
+POKEMINI_TLS unsigned int PRCColorOffset = 0;
+POKEMINI_TLS uint8_t *PRCColorTop = 0x00000000;
 
 // Color Flags
 // Bit 0 - New Color Palette
 // Bit 1 - Render to RAM
 // Bit 2 to 7 - Reserved
-uint8_t PRCColorFlags;
+POKEMINI_TLS uint8_t PRCColorFlags;
 
 //
 // Functions
@@ -81,6 +81,19 @@ void MinxColorPRC_Destroy(void)
 #endif
 }
 
+// Swap instance state
+void MinxColorPRC_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxColorPRC);
+	POKESWAP(sw, PRCColorVMem);
+	POKESWAP(sw, PRCColorPixels);
+	POKESWAP(sw, PRCColorPixelsOld);
+	POKESWAP(sw, PRCColorMap);
+	POKESWAP(sw, PRCColorOffset);
+	POKESWAP(sw, PRCColorTop);
+	POKESWAP(sw, PRCColorFlags);
+}
+
 void MinxColorPRC_Reset(int hardreset)
 {
 	// Initialize State
@@ -89,7 +102,7 @@ void MinxColorPRC_Reset(int hardreset)
 	MinxColorPRC.HNColor1 = 0xF0;
 }
 
-int MinxColorPRC_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxColorPRC_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(16384+32);
 	POKELOADSS_STREAM_A(PRCColorVMem, 16384);
@@ -109,7 +122,7 @@ int MinxColorPRC_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(16384+32);
 }
 
-int MinxColorPRC_SaveStateStream(memstream_t *stream)
+int MinxColorPRC_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(16384+32);
 	POKESAVESS_STREAM_A(PRCColorVMem, 16384);
@@ -127,6 +140,29 @@ int MinxColorPRC_SaveStateStream(memstream_t *stream)
 	POKESAVESS_END(16384+32);
 }
 
+// Check if the color PRC left power-on state
+int MinxColorPRC_InUse(void)
+{
+	TMinxColorPRC idle;
+
+	if (PRCColorMap) return 1;
+	memset((void *)&idle, 0, sizeof(TMinxColorPRC));
+	idle.LNColor1 = 0xF0;
+	idle.HNColor1 = 0xF0;
+	if (memcmp(&idle, &MinxColorPRC, sizeof(TMinxColorPRC))) return 1;
+	// All zero if the first byte is and every byte equals the next one
+	if (PRCColorVMem[0]) return 1;
+	return memcmp(PRCColorVMem, PRCColorVMem + 1, 16383) != 0;
+}
+
+// Back to power-on state, for states without the color PRC
+void MinxColorPRC_ClearState(void)
+{
+	MinxColorPRC_Reset(1);
+	memset(PRCColorVMem, 0, 16384);
+	PRCColorPixels = PRCColorVMem;
+}
+
 uint8_t MinxColorPRC_ReadReg(int cpu, uint8_t reg)
 {
 	uint8_t ret;
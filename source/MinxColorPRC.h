@@ -20,9 +20,7 @@
 #define MINXHW_COLORPRC
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 typedef struct {
 	uint16_t UnlockCode;
@@ -38,16 +36,17 @@ typedef struct {
 } TMinxColorPRC;
 
 // Export PRC state
-extern TMinxColorPRC MinxColorPRC;
+extern POKEMINI_TLS TMinxColorPRC MinxColorPRC;
 
 // For Unofficial Color Pokemon-Mini
 extern int PRCColorEnable;
-extern uint8_t *PRCColorPixels;
-extern uint8_t *PRCColorPixelsOld;
-extern uint8_t *PRCColorMap;
-extern unsigned int PRCColorOffset;
-extern uint8_t *PRCColorTop;
-extern uint8_t PRCColorFlags;
+extern POKEMINI_TLS uint8_t *PRCColorVMem;
+extern POKEMINI_TLS uint8_t *PRCColorPixels;
+extern POKEMINI_TLS uint8_t *PRCColorPixelsOld;
+extern POKEMINI_TLS uint8_t *PRCColorMap;
+extern POKEMINI_TLS unsigned int PRCColorOffset;
+extern POKEMINI_TLS uint8_t *PRCColorTop;
+extern POKEMINI_TLS uint8_t PRCColorFlags;
 extern const uint8_t PRCStaticColorMap[8];
 
 //
@@ -58,11 +57,17 @@ int MinxColorPRC_Create(void);
 
 void MinxColorPRC_Destroy(void);
 
+void MinxColorPRC_SwapContext(TPokeMini_Swap *sw);
+
 void MinxColorPRC_Reset(int hardreset);
 
-int MinxColorPRC_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxColorPRC_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
+
+int MinxColorPRC_SaveStateStream(TPokeMini_Stream *stream);
+
+int MinxColorPRC_InUse(void);
 
-int MinxColorPRC_SaveStateStream(memstream_t *stream);
+void MinxColorPRC_ClearState(void);
 
 uint8_t MinxColorPRC_ReadReg(int cpu, uint8_t reg);
 
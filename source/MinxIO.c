@@ -21,13 +21,13 @@
 #include <gw_malloc.h>
 #endif
 
-TMinxIO MinxIO;
-uint8_t *EEPROM = NULL;
-int PokeMini_Rumbling = 0;
-int PokeMini_RumblingLatch = 0;
-int PokeMini_EEPROMWritten = 0;
-int PokeMini_BatteryStatus = 0;  // 0 = Full, 1 = Low
-int PokeMini_ShockKey = 0;
+POKEMINI_TLS TMinxIO MinxIO;
+POKEMINI_TLS uint8_t *EEPROM = NULL;
+POKEMINI_TLS int PokeMini_Rumbling = 0;
+POKEMINI_TLS int PokeMini_RumblingLatch = 0;
+POKEMINI_TLS int PokeMini_EEPROMWritten = 0;
+POKEMINI_TLS int PokeMini_BatteryStatus = 0;  // 0 = Full, 1 = Low
+POKEMINI_TLS int PokeMini_ShockKey = 0;
 
 uint8_t MinxIO_IODataRead(void);
 void MinxIO_IODataWrite(void);
@@ -67,6 +67,18 @@ void MinxIO_Destroy(void)
 #endif
 }
 
+// Swap instance state
+void MinxIO_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxIO);
+	POKESWAP(sw, EEPROM);
+	POKESWAP(sw, PokeMini_Rumbling);
+	POKESWAP(sw, PokeMini_RumblingLatch);
+	POKESWAP(sw, PokeMini_EEPROMWritten);
+	POKESWAP(sw, PokeMini_BatteryStatus);
+	POKESWAP(sw, PokeMini_ShockKey);
+}
+
 void MinxIO_Reset(int hardreset)
 {
 	// Initialize State
@@ -84,7 +96,7 @@ void MinxIO_Reset(int hardreset)
 	MinxIO_BatteryLow(PokeMini_BatteryStatus);
 }
 
-int MinxIO_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxIO_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(32+8192);
 	PokeMini_Rumbling = 0;
@@ -101,7 +113,7 @@ int MinxIO_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(32+8192);
 }
 
-int MinxIO_SaveStateStream(memstream_t *stream)
+int MinxIO_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(32+8192);
 	POKESAVESS_STREAM_8(MinxIO.EEPLastPins);
@@ -20,9 +20,7 @@
 #define MINXHW_IO
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 typedef struct {
 	// Internal processing
@@ -35,16 +33,17 @@ typedef struct {
 } TMinxIO;
 
 // Export IO state
-extern TMinxIO MinxIO;
+extern POKEMINI_TLS TMinxIO MinxIO;
 
 // EEPROM Data
-extern uint8_t *EEPROM;
+extern POKEMINI_TLS uint8_t *EEPROM;
 
 // Rumbling & EEPROM written state
-extern int PokeMini_Rumbling;
-extern int PokeMini_RumblingLatch;
-extern int PokeMini_EEPROMWritten;
-extern int PokeMini_BatteryStatus;  // 0 = Full, 1 = Low
+extern POKEMINI_TLS int PokeMini_Rumbling;
+extern POKEMINI_TLS int PokeMini_RumblingLatch;
+extern POKEMINI_TLS int PokeMini_EEPROMWritten;
+extern POKEMINI_TLS int PokeMini_BatteryStatus;  // 0 = Full, 1 = Low
+extern POKEMINI_TLS int PokeMini_ShockKey;
 
 enum {
 	// EEPROM Listen State
@@ -95,11 +94,13 @@ int MinxIO_Create(void);
 
 void MinxIO_Destroy(void);
 
+void MinxIO_SwapContext(TPokeMini_Swap *sw);
+
 void MinxIO_Reset(int hardreset);
 
-int MinxIO_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxIO_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxIO_SaveStateStream(memstream_t *stream);
+int MinxIO_SaveStateStream(TPokeMini_Stream *stream);
 
 int MinxIO_FormatEEPROM(void);
 
@@ -18,7 +18,7 @@
 
 #include "PokeMini.h"
 
-int MinxIRQ_MasterIRQ = 0;
+POKEMINI_TLS int MinxIRQ_MasterIRQ = 0;
 
 void MinxIRQ_Process(void);
 
@@ -38,6 +38,12 @@ void MinxIRQ_Destroy(void)
 {
 }
 
+// Swap instance state
+void MinxIRQ_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxIRQ_MasterIRQ);
+}
+
 void MinxIRQ_Reset(int hardreset)
 {
 	// Master IRQ enable
@@ -48,14 +54,14 @@ void MinxIRQ_Reset(int hardreset)
 	PMR_IRQ_ACT4 = 0x00;
 }
 
-int MinxIRQ_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxIRQ_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(1);
 	POKELOADSS_STREAM_8(MinxIRQ_MasterIRQ);
 	POKELOADSS_END(1);
 }
 
-int MinxIRQ_SaveStateStream(memstream_t *stream)
+int MinxIRQ_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(1);
 	POKESAVESS_STREAM_8(MinxIRQ_MasterIRQ);
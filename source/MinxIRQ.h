@@ -20,23 +20,23 @@
 #define MINXHW_IRQ
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 // Master IRQ enable
-extern int MinxIRQ_MasterIRQ;
+extern POKEMINI_TLS int MinxIRQ_MasterIRQ;
 
 
 int MinxIRQ_Create(void);
 
 void MinxIRQ_Destroy(void);
 
+void MinxIRQ_SwapContext(TPokeMini_Swap *sw);
+
 void MinxIRQ_Reset(int hardreset);
 
-int MinxIRQ_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxIRQ_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxIRQ_SaveStateStream(memstream_t *stream);
+int MinxIRQ_SaveStateStream(TPokeMini_Stream *stream);
 
 void MinxIRQ_SetIRQ(uint8_t intr);
 
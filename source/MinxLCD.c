@@ -22,12 +22,15 @@
 #include <gw_malloc.h>
 #endif
 
-TMinxLCD MinxLCD;
-int LCDDirty = 0;
-uint8_t *LCDData = NULL;
-uint8_t *LCDPixelsD = NULL;
-uint8_t *LCDPixelsA = NULL;
-uint8_t *LCDPixelsAS = NULL;
+POKEMINI_TLS TMinxLCD MinxLCD;
+POKEMINI_TLS int LCDDirty = 0;
+POKEMINI_TLS uint8_t *LCDData = NULL;
+POKEMINI_TLS uint8_t *LCDPixelsD = NULL;
+POKEMINI_TLS uint8_t *LCDPixelsA = NULL;
+POKEMINI_TLS uint8_t *LCDPixelsAS = NULL;
+
+// Last value read from LCD
+POKEMINI_TLS uint8_t MinxLCD_ReadData = 0x40;
 
 const int LCDDirtyPixels[4] = {
 	4, // LCDMODE_ANALOG
@@ -84,6 +87,19 @@ void MinxLCD_Destroy(void)
 #endif
 }
 
+// Swap instance state
+void MinxLCD_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxLCD);
+	POKESWAP(sw, LCDDirty);
+	POKESWAP(sw, LCDData);
+	POKESWAP(sw, LCDPixelsD);
+	POKESWAP(sw, LCDPixelsA);
+	POKESWAP(sw, LCDPixelsAS);
+	POKESWAP(sw, MinxLCD_ReadData);
+	if (POKESWAP_NEW(sw)) MinxLCD_ReadData = 0x40;
+}
+
 void MinxLCD_Reset(int hardreset)
 {
 	// Clean up memory
@@ -98,7 +114,7 @@ void MinxLCD_Reset(int hardreset)
 	MinxLCD_SetContrast(0x1F);
 }
 
-int MinxLCD_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxLCD_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(256*9 + 96*64 + 96*64 + 64);
 	POKELOADSS_STREAM_A(LCDData, 256*9);
@@ -124,7 +140,7 @@ int MinxLCD_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(256*9 + 96*64 + 96*64 + 64);
 }
 
-int MinxLCD_SaveStateStream(memstream_t *stream)
+int MinxLCD_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(256*9 + 96*64 + 96*64 + 64);
 	POKESAVESS_STREAM_A(LCDData, 256*9);
@@ -225,26 +241,32 @@ static const uint8_t BitsActives[256] = {
 	4, 5, 5, 6, 5, 6, 6, 7, 5, 6, 6, 7, 6, 7, 7, 8
 };
 
-void MinxLCD_DecayRefresh(void)
+// Return 1 if any analog pixel changed
+int MinxLCD_DecayRefresh(void)
 {
-	int i, level;
-	uint8_t sh;
+	int i, level, changed = 0;
+	uint8_t sh, amt;
 	// This is tuned for 5 shades
 	if (MinxLCD.DisplayOn) {
 		for (i=0; i<96*64; i++) {
 			sh = (LCDPixelsD[i] ? 0x08 : 0x00) | (LCDPixelsAS[i] >> 1);
 			LCDPixelsAS[i] = sh;
 			level = BitsActives[sh];
-			LCDPixelsA[i] = (MinxLCD.Pixel0Intensity * (4 - level) + MinxLCD.Pixel1Intensity * level) >> 2;
+			amt = (MinxLCD.Pixel0Intensity * (4 - level) + MinxLCD.Pixel1Intensity * level) >> 2;
+			changed |= LCDPixelsA[i] ^ amt;
+			LCDPixelsA[i] = amt;
 		}
 	} else {
 		for (i=0; i<96*64; i++) {
 			sh = (LCDPixelsAS[i] >> 1);
 			LCDPixelsAS[i] = sh;
 			level = BitsActives[sh];
-			LCDPixelsA[i] = (MinxLCD.Pixel0Intensity * (4 - level) + MinxLCD.Pixel1Intensity * level) >> 2;
+			amt = (MinxLCD.Pixel0Intensity * (4 - level) + MinxLCD.Pixel1Intensity * level) >> 2;
+			changed |= LCDPixelsA[i] ^ amt;
+			LCDPixelsA[i] = amt;
 		}
 	}
+	return changed != 0;
 }
 
 void MinxLCD_Render(void)
@@ -281,21 +303,20 @@ uint8_t MinxLCD_LCDReadCtrl(int cpu)
 
 uint8_t MinxLCD_LCDRead(int cpu)
 {
-	static uint8_t data = 0x40;
 	if (MinxLCD.SetContrast) {
 		MinxLCD.SetContrast = 0;
 		// Contrast query, cause incorrect value?
 		MinxLCD_SetContrast(0x3F);
-		data = 0;
+		MinxLCD_ReadData = 0;
 	} else {
 		// Get pixel
 		if (!MinxLCD.RequireDummyR && cpu) {
 			if (MinxLCD.SegmentDir) {
-				data = LCDData[131 - MinxLCD.Column + (MinxLCD.Page << 8)];
+				MinxLCD_ReadData = LCDData[131 - MinxLCD.Column + (MinxLCD.Page << 8)];
 			} else {
-				data = LCDData[MinxLCD.Column + (MinxLCD.Page << 8)];
+				MinxLCD_ReadData = LCDData[MinxLCD.Column + (MinxLCD.Page << 8)];
 			}
-			if (MinxLCD.Page >= 8) data &= 0x01;
+			if (MinxLCD.Page >= 8) MinxLCD_ReadData &= 0x01;
 			if (!MinxLCD.ReadModifyMode) {
 				MinxLCD.Column++;
 				if (MinxLCD.Column > 131) MinxLCD.Column = 131;
@@ -303,7 +324,7 @@ uint8_t MinxLCD_LCDRead(int cpu)
 			}
 		} else MinxLCD.RequireDummyR = 0;
 	}
-	return data;
+	return MinxLCD_ReadData;
 }
 
 void MinxLCD_LCDWriteCtrl(uint8_t data)
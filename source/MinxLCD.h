@@ -20,9 +20,7 @@
 #define MINXHW_LCD
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 typedef struct {
 	// Internal processing
@@ -53,36 +51,41 @@ typedef struct {
 #endif
 
 // Export LCD state
-extern TMinxLCD MinxLCD;
+extern POKEMINI_TLS TMinxLCD MinxLCD;
 
 // LCD dirty status (1+ = graphics changed)
-extern int LCDDirty;
+extern POKEMINI_TLS int LCDDirty;
 
 // LCD Data (132 x 65 x 1bpp), Pitch of 256 bytes
-extern uint8_t *LCDData;
+extern POKEMINI_TLS uint8_t *LCDData;
 
 // LCD Pixels Digital (96 x 64, 0 or 1)
-extern uint8_t *LCDPixelsD;
+extern POKEMINI_TLS uint8_t *LCDPixelsD;
 
 // LCD Pixels Analog (96 x 64, 0 to 255)
-extern uint8_t *LCDPixelsA;
+extern POKEMINI_TLS uint8_t *LCDPixelsA;
+
+// Last value read from LCD
+extern POKEMINI_TLS uint8_t MinxLCD_ReadData;
 
 
 int MinxLCD_Create(void);
 
 void MinxLCD_Destroy(void);
 
+void MinxLCD_SwapContext(TPokeMini_Swap *sw);
+
 void MinxLCD_Reset(int hardreset);
 
-int MinxLCD_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxLCD_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxLCD_SaveStateStream(memstream_t *stream);
+int MinxLCD_SaveStateStream(TPokeMini_Stream *stream);
 
 uint8_t MinxLCD_ReadReg(int cpu, uint8_t reg);
 
 void MinxLCD_WriteReg(int cpu, uint8_t reg, uint8_t val);
 
-void MinxLCD_DecayRefresh(void);
+int MinxLCD_DecayRefresh(void);
 
 void MinxLCD_Render(void);
 
@@ -19,12 +19,12 @@
 #include <retro_inline.h>
 #include "PokeMini.h"
 
-TMinxPRC MinxPRC;
-int PRCAllowStall = 1;	// Allow stall CPU?
-int StallCPU = 0;	// Stall CPU output flag
-int PRCRenderBD = 0;	// Render backdrop? (Background overrides backdrop)
-int PRCRenderBG = 1;	// Render background?
-int PRCRenderSpr = 1;	// Render sprites?
+POKEMINI_TLS TMinxPRC MinxPRC;
+POKEMINI_TLS int PRCAllowStall = 1;	// Allow stall CPU?
+POKEMINI_TLS int StallCPU = 0;	// Stall CPU output flag
+POKEMINI_TLS int PRCRenderBD = 0;	// Render backdrop? (Background overrides backdrop)
+POKEMINI_TLS int PRCRenderBG = 1;	// Render background?
+POKEMINI_TLS int PRCRenderSpr = 1;	// Render sprites?
 
 const uint8_t PRCInvertBit[256] = { // Invert Bit table
 	0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
@@ -46,12 +46,12 @@ const uint8_t PRCInvertBit[256] = { // Invert Bit table
 };
 
 #ifdef PERFORMANCE
-int StallCycles = 64;	// Stall CPU cycles
+POKEMINI_TLS int StallCycles = 64;	// Stall CPU cycles
 #else
-int StallCycles = 32;	// Stall CPU cycles
+POKEMINI_TLS int StallCycles = 32;	// Stall CPU cycles
 #endif
 
-TMinxPRC_Render MinxPRC_Render = MinxPRC_Render_Mono;
+POKEMINI_TLS TMinxPRC_Render MinxPRC_Render = MinxPRC_Render_Mono;
 
 //
 // Functions
@@ -69,6 +69,30 @@ void MinxPRC_Destroy(void)
 {
 }
 
+// Swap instance state
+void MinxPRC_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxPRC);
+	POKESWAP(sw, PRCAllowStall);
+	POKESWAP(sw, StallCPU);
+	POKESWAP(sw, PRCRenderBD);
+	POKESWAP(sw, PRCRenderBG);
+	POKESWAP(sw, PRCRenderSpr);
+	POKESWAP(sw, StallCycles);
+	POKESWAP(sw, MinxPRC_Render);
+	if (POKESWAP_NEW(sw)) {
+		PRCAllowStall = 1;
+		PRCRenderBG = 1;
+		PRCRenderSpr = 1;
+#ifdef PERFORMANCE
+		StallCycles = 64;
+#else
+		StallCycles = 32;
+#endif
+		MinxPRC_Render = MinxPRC_Render_Mono;
+	}
+}
+
 void MinxPRC_Reset(int hardreset)
 {
 	// Initialize State
@@ -79,7 +103,7 @@ void MinxPRC_Reset(int hardreset)
 	MinxPRC.PRCRateMatch = 0x10;
 }
 
-int MinxPRC_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxPRC_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(1+32);
 	POKELOADSS_STREAM_8(StallCPU);
@@ -97,7 +121,7 @@ int MinxPRC_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(1+32);
 }
 
-int MinxPRC_SaveStateStream(memstream_t *stream)
+int MinxPRC_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(1+32);
 	POKESAVESS_STREAM_8(StallCPU);
@@ -129,7 +153,7 @@ void MinxPRC_Sync(void)
 			if (MinxPRC.PRCState == 1) return;
 			if (MinxPRC.PRCMode == 2) {
 				if (PRCAllowStall) StallCPU = 1;
-				MinxPRC_Render();
+				if (!(PokeMini_HiddenFrame & POKEMINI_HIDE_VIDEO)) MinxPRC_Render();
 				MinxPRC.PRCState = 1;
 			} else if (PRCColorMap) MinxPRC_NoRender_Color();
 		} else if ((MinxPRC.PRCCnt & 0xFF000000) == 0x39000000) {
@@ -159,6 +183,48 @@ void MinxPRC_Sync(void)
 	}
 }
 
+// Cycles until MinxPRC_Sync does anything other than counting, at least 1
+int MinxPRC_NextEvent(void)
+{
+	int32_t target;
+
+	if ((PMR_PRC_RATE & 0xF0) >= MinxPRC.PRCRateMatch) {
+		// Active frame
+		if (MinxPRC.PRCCnt < 0x18000000) {
+			if (MinxPRC.PRCState) return 1;
+			target = 0x18000000;
+		} else if ((MinxPRC.PRCCnt & 0xFF000000) == 0x18000000) {
+			// Color PRC without rendering updates on every sync
+			if ((MinxPRC.PRCState != 1) && ((MinxPRC.PRCMode == 2) || PRCColorMap)) return 1;
+			target = 0x39000000;
+		} else if ((MinxPRC.PRCCnt & 0xFF000000) == 0x39000000) {
+			if ((MinxPRC.PRCState != 2) && MinxPRC.PRCMode) return 1;
+			target = 0x42000000;
+		} else if (MinxPRC.PRCCnt < 0x39000000) {
+			target = 0x39000000;
+		} else {
+			target = 0x42000000;
+		}
+	} else {
+		// Non-active frame
+		target = 0x42000000;
+	}
+	if (MinxPRC.PRCCnt >= target) return 1;
+
+	return (target - MinxPRC.PRCCnt + MINX_PRCTIMERINC - 1) / MINX_PRCTIMERINC;
+}
+
+// Cycles until reading a register may return a different value,
+//   changes from MinxPRC_NextEvent aren't counted
+int MinxPRC_ReadHorizon(uint8_t reg)
+{
+	if (reg == 0x8A) {
+		// PRC Counter
+		return (0x01000000 - (MinxPRC.PRCCnt & 0x00FFFFFF) + MINX_PRCTIMERINC - 1) / MINX_PRCTIMERINC;
+	}
+	return 0x7FFFFFFF;
+}
+
 uint8_t MinxPRC_ReadReg(uint8_t reg)
 {
 	// 0x80 to 0x8F
@@ -20,9 +20,7 @@
 #define MINXHW_PRC
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 typedef struct {
 	// Internal processing
@@ -41,25 +39,25 @@ typedef struct {
 typedef void (*TMinxPRC_Render)(void);
 
 // Export PRC state
-extern TMinxPRC MinxPRC;
+extern POKEMINI_TLS TMinxPRC MinxPRC;
 
 // Invert bit table
 extern const uint8_t PRCInvertBit[256];
 
 // Stall CPU
-extern int PRCAllowStall;
-extern int StallCPU;
-extern int StallCycles;
+extern POKEMINI_TLS int PRCAllowStall;
+extern POKEMINI_TLS int StallCPU;
+extern POKEMINI_TLS int StallCycles;
 
 // Render backdrop? (Background overrides backdrop)
-extern int PRCRenderBD;
+extern POKEMINI_TLS int PRCRenderBD;
 // Render background?
-extern int PRCRenderBG;
+extern POKEMINI_TLS int PRCRenderBG;
 // Render sprites?
-extern int PRCRenderSpr;
+extern POKEMINI_TLS int PRCRenderSpr;
 
 // Render callback
-extern TMinxPRC_Render MinxPRC_Render;
+extern POKEMINI_TLS TMinxPRC_Render MinxPRC_Render;
 
 enum {
 	MINX_INTR_03 = 0x03, // PRC Copy Complete
@@ -74,14 +72,20 @@ int MinxPRC_Create(void);
 
 void MinxPRC_Destroy(void);
 
+void MinxPRC_SwapContext(TPokeMini_Swap *sw);
+
 void MinxPRC_Reset(int hardreset);
 
-int MinxPRC_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxPRC_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxPRC_SaveStateStream(memstream_t *stream);
+int MinxPRC_SaveStateStream(TPokeMini_Stream *stream);
 
 void MinxPRC_Sync(void);
 
+int MinxPRC_NextEvent(void);
+
+int MinxPRC_ReadHorizon(uint8_t reg);
+
 uint8_t MinxPRC_ReadReg(uint8_t reg);
 
 void MinxPRC_WriteReg(uint8_t reg, uint8_t val);
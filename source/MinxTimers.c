@@ -18,7 +18,7 @@
 
 #include "PokeMini.h"
 
-TMinxTimers MinxTimers;
+POKEMINI_TLS TMinxTimers MinxTimers;
 
 // Calculate decrease on oscillator 1
 const uint32_t MinxTimers_CalculateDecOsc1[16] = {
@@ -81,6 +81,12 @@ void MinxTimers_Destroy(void)
 {
 }
 
+// Swap instance state
+void MinxTimers_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MinxTimers);
+}
+
 void MinxTimers_Reset(int hardreset)
 {
 	if (hardreset) {
@@ -97,7 +103,7 @@ void MinxTimers_Reset(int hardreset)
 	MinxTimers.Tmr3PreB = 0xFFFFFFFF;
 }
 
-int MinxTimers_LoadStateStream(memstream_t *stream, uint32_t bsize)
+int MinxTimers_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize)
 {
 	POKELOADSS_START(128);
 	POKELOADSS_STREAM_32(MinxTimers.SecTimerCnt);
@@ -139,7 +145,7 @@ int MinxTimers_LoadStateStream(memstream_t *stream, uint32_t bsize)
 	POKELOADSS_END(128);
 }
 
-int MinxTimers_SaveStateStream(memstream_t *stream)
+int MinxTimers_SaveStateStream(TPokeMini_Stream *stream)
 {
 	POKESAVESS_STREAM_START(128);
 	POKESAVESS_STREAM_32(MinxTimers.SecTimerCnt);
@@ -345,6 +351,110 @@ void MinxTimers_Sync(void)
 	}
 }
 
+// Cycles until a counter decreasing by dec per cycle wraps around
+static INLINE uint32_t MinxTimers_Underflow(uint32_t next, uint32_t cnt, uint32_t dec)
+{
+	uint32_t cycles;
+	if (!dec) return next;
+	cycles = cnt / dec + 1;
+	return (cycles < next) ? cycles : next;
+}
+
+// Cycles until MinxTimers_Sync does anything other than counting
+//   (IRQ, reload, 16-bits carry or timer 3 pivot), at least 1
+int MinxTimers_NextEvent(void)
+{
+	uint32_t next = 0x7FFFFFFF;
+	uint32_t cycles, limit;
+
+	// 256Hz Timer, 32Hz steps
+	if (PMR_TMR256_CTRL) {
+		next = (0x08000000 - (MinxTimers.Tmr8Cnt & 0x07FFFFFF) + MINX_TIMER256INC - 1) / MINX_TIMER256INC;
+	}
+
+	// Timer 1
+	if (MinxTimers.Tmr1WMode) {
+		if (MinxTimers.Tmr1LEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr1CntA, MinxTimers.Tmr1DecA);
+	} else {
+		if (MinxTimers.Tmr1LEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr1CntA, MinxTimers.Tmr1DecA);
+		if (MinxTimers.Tmr1HEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr1CntB, MinxTimers.Tmr1DecB);
+	}
+
+	// Timer 2
+	if (MinxTimers.Tmr2WMode) {
+		if (MinxTimers.Tmr2LEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr2CntA, MinxTimers.Tmr2DecA);
+	} else {
+		if (MinxTimers.Tmr2LEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr2CntA, MinxTimers.Tmr2DecA);
+		if (MinxTimers.Tmr2HEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr2CntB, MinxTimers.Tmr2DecB);
+	}
+
+	// Timer 3
+	if (MinxTimers.Tmr3WMode) {
+		if (MinxTimers.Tmr3LEna) {
+			next = MinxTimers_Underflow(next, MinxTimers.Tmr3CntA, MinxTimers.Tmr3DecA);
+			// Pivot, the high byte only changes on underflow
+			if (MinxTimers.Tmr3Cnt16.B.L != (MinxTimers.Tmr3CntA >> 24)) return 1;
+			if ((MinxTimers.Tmr3Cnt16.W > MinxTimers.Timer3Piv) && ((MinxTimers.Tmr3Cnt16.B.H << 8) <= MinxTimers.Timer3Piv) && MinxTimers.Tmr3DecA) {
+				limit = ((MinxTimers.Timer3Piv & 0xFF) + 1) << 24;
+				cycles = (MinxTimers.Tmr3CntA - limit) / MinxTimers.Tmr3DecA + 1;
+				if (cycles < next) next = cycles;
+			}
+		}
+	} else {
+		if (MinxTimers.Tmr3LEna) next = MinxTimers_Underflow(next, MinxTimers.Tmr3CntA, MinxTimers.Tmr3DecA);
+		if (MinxTimers.Tmr3HEna) {
+			next = MinxTimers_Underflow(next, MinxTimers.Tmr3CntB, MinxTimers.Tmr3DecB);
+			// Pivot, checked when the high byte changes
+			if (MinxTimers.Tmr3Cnt16.B.H != (MinxTimers.Tmr3CntB >> 24)) return 1;
+			next = MinxTimers_Underflow(next, MinxTimers.Tmr3CntB & 0x00FFFFFF, MinxTimers.Tmr3DecB);
+		}
+	}
+
+	return (int)next;
+}
+
+// Cycles until the high byte of a counting down timer changes
+static INLINE int MinxTimers_ByteChange(uint32_t cnt, uint32_t dec)
+{
+	if (!dec) return 0x7FFFFFFF;
+	return (int)((cnt & 0x00FFFFFF) / dec + 1);
+}
+
+// Cycles until reading a register may return a different value,
+//   changes from MinxTimers_NextEvent aren't counted
+int MinxTimers_ReadHorizon(uint8_t reg)
+{
+	switch(reg) {
+		case 0x09: // Second Counter Low
+		case 0x0A: // Second Counter Med
+		case 0x0B: // Second Counter High
+			if (!PMR_SEC_CTRL) break;
+			return 4000000 - MinxTimers.TmrSecs;
+		case 0x36: // Timer 1 Count A
+			if (!MinxTimers.Tmr1LEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr1CntA, MinxTimers.Tmr1DecA);
+		case 0x37: // Timer 1 Count B (16-Bits mode changes on underflow)
+			if (MinxTimers.Tmr1WMode || !MinxTimers.Tmr1HEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr1CntB, MinxTimers.Tmr1DecB);
+		case 0x3E: // Timer 2 Count A
+			if (!MinxTimers.Tmr2LEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr2CntA, MinxTimers.Tmr2DecA);
+		case 0x3F: // Timer 2 Count B
+			if (MinxTimers.Tmr2WMode || !MinxTimers.Tmr2HEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr2CntB, MinxTimers.Tmr2DecB);
+		case 0x41: // 256 Hz Timer Counter
+			if (!PMR_TMR256_CTRL) break;
+			return (0x01000000 - (MinxTimers.Tmr8Cnt & 0x00FFFFFF) + MINX_TIMER256INC - 1) / MINX_TIMER256INC;
+		case 0x4E: // Timer 3 Count A
+			if (!MinxTimers.Tmr3LEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr3CntA, MinxTimers.Tmr3DecA);
+		case 0x4F: // Timer 3 Count B
+			if (MinxTimers.Tmr3WMode || !MinxTimers.Tmr3HEna) break;
+			return MinxTimers_ByteChange(MinxTimers.Tmr3CntB, MinxTimers.Tmr3DecB);
+	}
+	return 0x7FFFFFFF;
+}
+
 uint8_t MinxTimers_ReadReg(uint8_t reg)
 {
 	// 0x08 to 0x0F, 0x18 to 0x1F, 0x30 to 0x41, 0x48 to 0x4F
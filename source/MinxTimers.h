@@ -20,9 +20,7 @@
 #define MINXHW_TIMERS
 
 #include <stdint.h>
-#ifndef TARGET_GNW
-#include <streams/memory_stream.h>
-#endif
+#include "PMCommon.h"
 
 /* For some reason, '_BIG_ENDIAN' is always defined when
  * building for 3DS/Switch with devkitarm/a64... */
@@ -89,7 +87,7 @@ typedef struct {
 } TMinxTimers;
 
 // Export Timers state
-extern TMinxTimers MinxTimers;
+extern POKEMINI_TLS TMinxTimers MinxTimers;
 
 // Interrupt table
 enum {
@@ -114,14 +112,20 @@ int MinxTimers_Create(void);
 
 void MinxTimers_Destroy(void);
 
+void MinxTimers_SwapContext(TPokeMini_Swap *sw);
+
 void MinxTimers_Reset(int hardreset);
 
-int MinxTimers_LoadStateStream(memstream_t *stream, uint32_t bsize);
+int MinxTimers_LoadStateStream(TPokeMini_Stream *stream, uint32_t bsize);
 
-int MinxTimers_SaveStateStream(memstream_t *stream);
+int MinxTimers_SaveStateStream(TPokeMini_Stream *stream);
 
 void MinxTimers_Sync(void);
 
+int MinxTimers_NextEvent(void);
+
+int MinxTimers_ReadHorizon(uint8_t reg);
+
 uint8_t MinxTimers_ReadReg(uint8_t reg);
 
 void MinxTimers_WriteReg(unsigned char reg, unsigned char val);
@@ -20,22 +20,22 @@
 #include "Multicart.h"
 
 // Multicart Read/Write
-TMulticartRead MulticartRead = NULL;
-TMulticartWrite MulticartWrite = NULL;
+POKEMINI_TLS TMulticartRead MulticartRead = NULL;
+POKEMINI_TLS TMulticartWrite MulticartWrite = NULL;
 
 // Multicart state
-int PM_MM_Type = 0;		// Multicart Type
-int PM_MM_Dirty = 0;		// ROM Dirty?
-int PM_MM_BusCycle = 0;		// Flash cart state
-int PM_MM_GetID = 0;		// Get ID on next read
-int PM_MM_Bypass = 0;		// Flash Bypass
-int PM_MM_Command = 0;		// 0 = None, 1 = Write, 2 = Erase
-uint32_t PM_MM_Offset = 0;	// ROM Offset in bytes
+POKEMINI_TLS int PM_MM_Type = 0;		// Multicart Type
+POKEMINI_TLS int PM_MM_Dirty = 0;		// ROM Dirty?
+POKEMINI_TLS int PM_MM_BusCycle = 0;		// Flash cart state
+POKEMINI_TLS int PM_MM_GetID = 0;		// Get ID on next read
+POKEMINI_TLS int PM_MM_Bypass = 0;		// Flash Bypass
+POKEMINI_TLS int PM_MM_Command = 0;		// 0 = None, 1 = Write, 2 = Erase
+POKEMINI_TLS uint32_t PM_MM_Offset = 0;	// ROM Offset in bytes
 
 // For misc information
-uint32_t PM_MM_LastErase_Start = 0;	// Last erased start
-uint32_t PM_MM_LastErase_End = 0;	// Last erased end
-uint32_t PM_MM_LastProg = 0;		// Last programmed offset
+POKEMINI_TLS uint32_t PM_MM_LastErase_Start = 0;	// Last erased start
+POKEMINI_TLS uint32_t PM_MM_LastErase_End = 0;	// Last erased end
+POKEMINI_TLS uint32_t PM_MM_LastProg = 0;		// Last programmed offset
 
 static int Multicart_AM29LV040B_Sectors[8][2] = {
 	{0x00000, 0x00000},
@@ -290,4 +290,22 @@ void SetMulticart(int type)
 		MulticartRead = Multicart_T0R;
 		MulticartWrite = Multicart_T0W;
 	}
+	PokeMini_MapMemory();
+}
+
+// Swap instance state
+void Multicart_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, MulticartRead);
+	POKESWAP(sw, MulticartWrite);
+	POKESWAP(sw, PM_MM_Type);
+	POKESWAP(sw, PM_MM_Dirty);
+	POKESWAP(sw, PM_MM_BusCycle);
+	POKESWAP(sw, PM_MM_GetID);
+	POKESWAP(sw, PM_MM_Bypass);
+	POKESWAP(sw, PM_MM_Command);
+	POKESWAP(sw, PM_MM_Offset);
+	POKESWAP(sw, PM_MM_LastErase_Start);
+	POKESWAP(sw, PM_MM_LastErase_End);
+	POKESWAP(sw, PM_MM_LastProg);
 }
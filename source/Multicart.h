@@ -20,30 +20,34 @@
 #define POKEMINI_MULTICART
 
 #include <stdint.h>
+#include "PMCommon.h"
 
 typedef uint8_t (*TMulticartRead)(uint32_t addr);
 typedef void (*TMulticartWrite)(uint32_t addr, uint8_t data);
 
 // Multicart read/write
-extern TMulticartRead MulticartRead;
-extern TMulticartWrite MulticartWrite;
+extern POKEMINI_TLS TMulticartRead MulticartRead;
+extern POKEMINI_TLS TMulticartWrite MulticartWrite;
 
 // Multicart state
-extern int PM_MM_Type;
-extern int PM_MM_Dirty;
-extern int PM_MM_BusCycle;
-extern int PM_MM_GetID;
-extern int PM_MM_Bypass;
-extern int PM_MM_Command;
-extern uint32_t PM_MM_Offset;
+extern POKEMINI_TLS int PM_MM_Type;
+extern POKEMINI_TLS int PM_MM_Dirty;
+extern POKEMINI_TLS int PM_MM_BusCycle;
+extern POKEMINI_TLS int PM_MM_GetID;
+extern POKEMINI_TLS int PM_MM_Bypass;
+extern POKEMINI_TLS int PM_MM_Command;
+extern POKEMINI_TLS uint32_t PM_MM_Offset;
 
 // For misc information
-extern uint32_t PM_MM_LastErase_Start;
-extern uint32_t PM_MM_LastErase_End;
-extern uint32_t PM_MM_LastProg;
+extern POKEMINI_TLS uint32_t PM_MM_LastErase_Start;
+extern POKEMINI_TLS uint32_t PM_MM_LastErase_End;
+extern POKEMINI_TLS uint32_t PM_MM_LastProg;
 
 // Set multicart
 void NewMulticart(void);
 void SetMulticart(int type);
 
+// Swap instance state
+void Multicart_SwapContext(TPokeMini_Swap *sw);
+
 #endif
@@ -33,6 +33,19 @@
 #define PMTMPV	512
 #endif
 
+// Per-instance variables
+//   With POKEMINI_THREADS each thread has its own copy of the emulator
+//   state, so every thread can run a separate instance
+#ifdef POKEMINI_THREADS
+#ifdef _MSC_VER
+#define POKEMINI_TLS	__declspec(thread)
+#else
+#define POKEMINI_TLS	__thread
+#endif
+#else
+#define POKEMINI_TLS
+#endif
+
 // Return true if the string is valid and non-empty
 int StringIsSet(char *str);
 
@@ -45,4 +58,106 @@ int FileExist(const char *filename);
 // Directories
 void PokeMini_InitDirs(char *argv0, char *exec);
 
+// CRC32 (IEEE), pass 0 as crc to start
+uint32_t PokeMini_CRC32(uint32_t crc, const void *data, uint32_t size);
+
+// 7-bit varint, low group first
+static INLINE uint8_t *PokeMini_PutVarint(uint8_t *out, uint32_t val)
+{
+	while (val >= 0x80) {
+		*out++ = (uint8_t)(val | 0x80);
+		val >>= 7;
+	}
+	*out++ = (uint8_t)val;
+	return out;
+}
+
+// Returns NULL if the varint doesn't end before end
+static INLINE const uint8_t *PokeMini_GetVarint(const uint8_t *in, const uint8_t *end, uint32_t *val)
+{
+	uint32_t res = 0;
+	int shift = 0;
+	while ((in < end) && (*in & 0x80)) {
+		if (shift > 21) return NULL;
+		res |= (uint32_t)(*in++ & 0x7F) << shift;
+		shift += 7;
+	}
+	if (in >= end) return NULL;
+	*val = res | ((uint32_t)*in++ << shift);
+	return in;
+}
+
+// Save state stream
+//   Each stream carries its own buffer and position, so states can be
+//   saved and loaded from several threads at once
+#ifndef TARGET_GNW
+typedef struct {
+	uint8_t *buf;		// Caller buffer
+	uint64_t size;		// Buffer size
+	uint64_t ptr;		// Current position
+} TPokeMini_Stream;
+
+static INLINE void PokeMini_StreamOpen(TPokeMini_Stream *stream, uint8_t *buf, uint64_t size)
+{
+	stream->buf = buf;
+	stream->size = size;
+	stream->ptr = 0;
+}
+
+static INLINE uint64_t PokeMini_StreamRead(TPokeMini_Stream *stream, void *data, uint64_t bytes)
+{
+	uint64_t avail = stream->size - stream->ptr;
+	if (bytes > avail) bytes = avail;
+	memcpy(data, stream->buf + stream->ptr, (size_t)bytes);
+	stream->ptr += bytes;
+	return bytes;
+}
+
+static INLINE uint64_t PokeMini_StreamWrite(TPokeMini_Stream *stream, const void *data, uint64_t bytes)
+{
+	uint64_t avail = stream->size - stream->ptr;
+	if (bytes > avail) bytes = avail;
+	memcpy(stream->buf + stream->ptr, data, (size_t)bytes);
+	stream->ptr += bytes;
+	return bytes;
+}
+
+// Skip bytes from the current position, return 0 on success
+static INLINE int PokeMini_StreamSkip(TPokeMini_Stream *stream, uint64_t bytes)
+{
+	if (bytes > stream->size - stream->ptr) return -1;
+	stream->ptr += bytes;
+	return 0;
+}
+#else
+#include <stdio.h>
+#define TPokeMini_Stream FILE
+#define PokeMini_StreamRead(stream, data, bytes) fread(data, 1, bytes, stream)
+#define PokeMini_StreamWrite(stream, data, bytes) fwrite(data, 1, bytes, stream)
+#define PokeMini_StreamSkip(stream, bytes) fseek(stream, bytes, SEEK_CUR)
+#endif
+
+// Instance state swap, see PokeMini_SelectContext()
+//   Each module moves its variables out to 'save' and in from 'load',
+//   always in the same order. Without 'load' they are cleared for a new
+//   instance, with 'count' set nothing is moved and only size is added
+typedef struct {
+	uint8_t *save;		// Outgoing instance, NULL to discard
+	const uint8_t *load;	// Incoming instance, NULL for a new one
+	uint32_t size;		// Bytes swapped so far
+	int count;		// Only count the size
+} TPokeMini_Swap;
+
+#define POKESWAP(sw, var) {\
+	if (!(sw)->count) {\
+		if ((sw)->save) memcpy((sw)->save + (sw)->size, (void *)&(var), sizeof(var));\
+		if ((sw)->load) memcpy((void *)&(var), (sw)->load + (sw)->size, sizeof(var));\
+		else memset((void *)&(var), 0, sizeof(var));\
+	}\
+	(sw)->size += sizeof(var);\
+}
+
+// True when the swap is bringing in a new instance
+#define POKESWAP_NEW(sw)	(!(sw)->count && !(sw)->load)
+
 #endif
@@ -18,34 +18,41 @@
 // Savestate file ID
 //   Change only if savestate structure file changes!
 #define PokeMini_ID 0x006B4D50
+// Same chunks as PokeMini_ID with an index after the header
+#define PokeMini_ID2 0x016B4D50
+// Same as PokeMini_ID2 with packed payloads and unused chunks left out
+#define PokeMini_ID3 0x026B4D50
 
 #include "PokeMini.h"
 #include <time.h>
 #ifndef TARGET_GNW
 #include <streams/file_stream.h>
+#include "StateHash.h"
 #else
 #include "rg_storage.h"
 #endif
 
 // Include Free BIOS
 #include "freebios.h"
-int PokeMini_FreeBIOS = 0;	// Using freebios?
+POKEMINI_TLS int PokeMini_FreeBIOS = 0;	// Using freebios?
 
-int PokeMini_Flags = 0;		// Configuration flags
-uint8_t PM_BIOS[4096];		// Pokemon-Mini BIOS ($000000 to $000FFF, 4096)
-uint8_t PM_RAM[8192];		// Pokemon-Mini RAM  ($001000 to $002100, 4096 + 256)
-uint8_t *PM_ROM = NULL;		// Pokemon-Mini ROM  ($002100 to $1FFFFF, Up to 2MB)
+POKEMINI_TLS int PokeMini_Flags = 0;		// Configuration flags
+POKEMINI_TLS uint8_t PM_BIOS[4096];		// Pokemon-Mini BIOS ($000000 to $000FFF, 4096)
+POKEMINI_TLS uint8_t PM_RAM[8192];		// Pokemon-Mini RAM  ($001000 to $002100, 4096 + 256)
+POKEMINI_TLS uint8_t *PM_ROM = NULL;		// Pokemon-Mini ROM  ($002100 to $1FFFFF, Up to 2MB)
 #ifndef TARGET_GNW
-int PM_ROM_Alloc = 0;		// Pokemon-Mini ROM Allocated on memory?
+POKEMINI_TLS int PM_ROM_Alloc = 0;		// Pokemon-Mini ROM Allocated on memory?
 #endif
-int PM_ROM_Size = 0;		// Pokemon-Mini ROM Size
-int PM_ROM_Mask = 0;		// Pokemon-Mini ROM Mask
-int PokeMini_LCDMode = 0;	// LCD Mode
-int PokeMini_ColorFormat = 0;	// Color Format (0 = 8x8, 1 = 4x4)
-int PokeMini_HostBattStatus = 0;// Host battery status
-int PokeMini_RumbleAnim = 0;	// Rumble animation
-
-int PokeMini_RumbleAmount[4] = { -2,  1, -1,  2 };
+POKEMINI_TLS int PM_ROM_Size = 0;		// Pokemon-Mini ROM Size
+POKEMINI_TLS int PM_ROM_Mask = 0;		// Pokemon-Mini ROM Mask
+POKEMINI_TLS int PokeMini_LCDMode = 0;	// LCD Mode
+POKEMINI_TLS int PokeMini_ColorFormat = 0;	// Color Format (0 = 8x8, 1 = 4x4)
+POKEMINI_TLS int PokeMini_HostBattStatus = 0;// Host battery status
+POKEMINI_TLS int PokeMini_HiddenFrame = 0;	// Hidden frame flags
+POKEMINI_TLS int PokeMini_LCDUpdated = 1;	// LCD pixels changed
+POKEMINI_TLS int PokeMini_RumbleAnim = 0;	// Rumble animation
+
+POKEMINI_TLS int PokeMini_RumbleAmount[4] = { -2,  1, -1,  2 };
 const int PokeMini_RumbleAmountTable[16] = {
 	 0,  0,  0,  0,
 	-1,  0,  1,  0,
@@ -89,7 +96,7 @@ const uint8_t PM_IO_INIT[256] = {
 };
 
 // Number of cycles to process on hardware
-int PokeHWCycles = 0;
+POKEMINI_TLS int PokeHWCycles = 0;
 
 // Create emulator and all interfaces
 int PokeMini_Create(int flags, int soundfifo)
@@ -129,6 +136,9 @@ int PokeMini_Create(int flags, int soundfifo)
 	SetMulticart(CommandLine.multicart);
 #endif
 
+	// Map memory
+	PokeMini_MapMemory();
+
 	return 1;
 }
 
@@ -153,11 +163,120 @@ void PokeMini_Destroy()
 		PM_ROM_Alloc = 0;
 	}
 #endif
+	PokeMini_MapMemory();
 
 	// Free color info
 	PokeMini_FreeColorInfo();
 }
 
+// Instance context
+struct TPokeMini_Context {
+	uint8_t *state;		// Saved state, NULL for a new instance
+};
+
+static POKEMINI_TLS TPokeMini_Context PokeMini_DefaultContext;
+static POKEMINI_TLS TPokeMini_Context *PokeMini_Context = NULL;	// NULL for the default one
+static POKEMINI_TLS uint32_t PokeMini_ContextSize = 0;
+
+// Swap the state of all interfaces
+static void PokeMini_SwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, CommandLine);
+	POKESWAP(sw, PokeMini_FreeBIOS);
+	POKESWAP(sw, PokeMini_Flags);
+	POKESWAP(sw, PM_BIOS);
+	POKESWAP(sw, PM_RAM);
+	POKESWAP(sw, PM_ROM);
+#ifndef TARGET_GNW
+	POKESWAP(sw, PM_ROM_Alloc);
+#endif
+	POKESWAP(sw, PM_ROM_Size);
+	POKESWAP(sw, PM_ROM_Mask);
+	POKESWAP(sw, PokeMini_LCDMode);
+	POKESWAP(sw, PokeMini_ColorFormat);
+	POKESWAP(sw, PokeMini_HostBattStatus);
+	POKESWAP(sw, PokeMini_RumbleAnim);
+	POKESWAP(sw, PokeMini_LCDUpdated);
+	POKESWAP(sw, PokeMini_RumbleAmount);
+	POKESWAP(sw, PokeHWCycles);
+	MinxCPU_SwapContext(sw);
+	MinxTimers_SwapContext(sw);
+	MinxIO_SwapContext(sw);
+	MinxIRQ_SwapContext(sw);
+	MinxPRC_SwapContext(sw);
+	MinxColorPRC_SwapContext(sw);
+	MinxLCD_SwapContext(sw);
+	MinxAudio_SwapContext(sw);
+	Multicart_SwapContext(sw);
+	PokeMini_VideoSwapContext(sw);
+#ifndef TARGET_GNW
+	PokeMini_StateHashSwapContext(sw);
+#endif
+	if (POKESWAP_NEW(sw)) {
+		CommandLineInit();
+		memcpy(PokeMini_RumbleAmount, &PokeMini_RumbleAmountTable[12], sizeof(PokeMini_RumbleAmount));
+	}
+}
+
+// New instance context, select it and call PokeMini_Create() to use it
+TPokeMini_Context *PokeMini_NewContext(void)
+{
+	TPokeMini_Context *ctx = (TPokeMini_Context *)malloc(sizeof(TPokeMini_Context));
+	if (ctx) ctx->state = NULL;
+	return ctx;
+}
+
+// Destroy the instance on a context and free it
+void PokeMini_FreeContext(TPokeMini_Context *ctx)
+{
+	TPokeMini_Context *prev = PokeMini_Context;
+
+	if (!ctx) return;
+	if (ctx->state || (ctx == prev)) {
+		// Instance was used, release its memory
+		if (!PokeMini_SelectContext(ctx)) return;
+		PokeMini_VideoPalette_Free();
+		PokeMini_Destroy();
+		if (!PokeMini_SelectContext((prev == ctx) ? NULL : prev)) return;
+	}
+	if (ctx->state) free(ctx->state);
+	free(ctx);
+}
+
+// Select the instance to run, return 1 on success
+int PokeMini_SelectContext(TPokeMini_Context *ctx)
+{
+	TPokeMini_Context *cur, *next;
+	TPokeMini_Swap sw;
+
+	if (ctx == PokeMini_Context) return 1;
+	cur = PokeMini_Context ? PokeMini_Context : &PokeMini_DefaultContext;
+	next = ctx ? ctx : &PokeMini_DefaultContext;
+	if (!PokeMini_ContextSize) {
+		memset(&sw, 0, sizeof(sw));
+		sw.count = 1;
+		PokeMini_SwapContext(&sw);
+		PokeMini_ContextSize = sw.size;
+	}
+	if (!cur->state) {
+		cur->state = (uint8_t *)malloc(PokeMini_ContextSize);
+		if (!cur->state) return 0;
+	}
+	sw.save = cur->state;
+	sw.load = next->state;
+	sw.size = 0;
+	sw.count = 0;
+	PokeMini_SwapContext(&sw);
+	PokeMini_Context = ctx;
+	return 1;
+}
+
+// Selected instance, NULL for the default one
+TPokeMini_Context *PokeMini_GetContext(void)
+{
+	return PokeMini_Context;
+}
+
 // Apply changes from command lines
 void PokeMini_ApplyChanges(void)
 {
@@ -167,6 +286,7 @@ void PokeMini_ApplyChanges(void)
 	PokeMini_SetVideo(PokeMini_VideoCurrent, PokeMini_VideoDepth, CommandLine.lcdfilter, CommandLine.lcdmode);
 	MinxAudio_ChangeFilter(CommandLine.piezofilter);
 	for (i=0; i<4; i++) PokeMini_RumbleAmount[i] = PokeMini_RumbleAmountTable[((CommandLine.rumblelvl & 3) << 2) | i];
+	MinxCPU_IdleSkip = CommandLine.idleskip;
 }
 
 // Low power battery emulation
@@ -246,6 +366,7 @@ int PokeMini_NewMIN(uint32_t size)
 	PM_ROM_Mask = GetMultiple2Mask(size);
 	PM_ROM_Size = PM_ROM_Mask + 1;
 	PM_ROM = (uint8_t *)malloc(PM_ROM_Size);
+	PokeMini_MapMemory();
 	if (!PM_ROM)
 		return 0;
 	memset(PM_ROM, 0xFF, PM_ROM_Size);
@@ -262,6 +383,7 @@ void PokeMini_FreeColorInfo(void)
 	{
 		free(PRCColorMap);
 		PRCColorMap = NULL;
+		PokeMini_MapMemory();
 	}
 }
 
@@ -335,125 +457,369 @@ int PokeMini_SaveEEPROMFile(const char *filename)
 	return (writebytes == 8192);
 }
 
-#ifndef TARGET_GNW
-// Load emulator state from memory stream
-int PokeMini_LoadSSStream(uint8_t *buffer, uint64_t size)
+// Load idle loops white/blacklist
+//   One loop per line: address mode [period hits skipped]
+int PokeMini_LoadIdleFile(const char *filename)
 {
-	memstream_t *stream;
-	int readbytes;
-	char PMiniStr[PMTMPV];
-	uint32_t PMiniID, StatTime, BSize;
+	TMinxCPU_IdleLoop *loop;
+	char line[128];
+	unsigned int pc, hits;
+	unsigned long long skipped;
+	int mode, period, num;
 
-	// Open memory stream
-	memstream_set_buffer(buffer, size);
-	stream = memstream_open(0);
-	if (stream == NULL)
+	// Open file
+#ifndef TARGET_GNW
+	RFILE *fi = filestream_open(filename,
+			RETRO_VFS_FILE_ACCESS_READ,
+			RETRO_VFS_FILE_ACCESS_HINT_NONE);
+	if (!fi)
 		return 0;
-
-	// Read content
-	PMiniStr[12] = 0;
-	readbytes = memstream_read(stream, PMiniStr, 12);	// Read File ID
-	if ((readbytes != 12) || strcmp(PMiniStr, "PokeMiniStat")) {
-		memstream_close(stream);
-		memstream_set_buffer(NULL, 0);
+	while (filestream_gets(fi, line, sizeof(line))) {
+#else
+	FILE *fi = fopen(filename, "r");
+	if (!fi)
 		return 0;
+	while (fgets(line, sizeof(line), fi)) {
+#endif
+		if (line[0] == ';') continue;
+		num = sscanf(line, "%x %d %d %u %llu", &pc, &mode, &period, &hits, &skipped);
+		if (num < 2) continue;
+		loop = MinxCPU_IdleLoop(pc);
+		if (!loop) break;
+		loop->Mode = mode;
+		if (num == 5) {
+			loop->Period = period;
+			loop->Hits = hits;
+			loop->Skipped = skipped;
+		}
 	}
-	readbytes = memstream_read(stream, &PMiniID, 4);	// Read State ID
-	if ((readbytes != 4) || (PMiniID != PokeMini_ID)) {
-		memstream_close(stream);
-		memstream_set_buffer(NULL, 0);
+#ifndef TARGET_GNW
+	filestream_close(fi);
+#else
+	fclose(fi);
+#endif
+
+	return 1;
+}
+
+// Save idle loops report
+int PokeMini_SaveIdleFile(const char *filename)
+{
+	static const char header[] =
+		"; PokeMini idle loops\n"
+		"; mode: 1 = Whitelisted, 0 = Auto, -1 = Blacklisted\n"
+		"; address mode period hits skipped\n";
+	TMinxCPU_IdleLoop *loop;
+	char line[128];
+	int i, len;
+
+	// Open file
+#ifndef TARGET_GNW
+	RFILE *fo = filestream_open(filename,
+			RETRO_VFS_FILE_ACCESS_WRITE,
+			RETRO_VFS_FILE_ACCESS_HINT_NONE);
+	if (!fo)
 		return 0;
-	}
-	readbytes = memstream_read(stream, &StatTime, 4);	// Read Time
-	if (readbytes != 4) {
-		memstream_close(stream);
-		memstream_set_buffer(NULL, 0);
+	filestream_write(fo, header, sizeof(header) - 1);
+#else
+	FILE *fo = fopen(filename, "w");
+	if (!fo)
 		return 0;
+	fwrite(header, 1, sizeof(header) - 1, fo);
+#endif
+
+	// Write content
+	for (i=0; i<MinxCPU_IdleNum; i++) {
+		loop = &MinxCPU_IdleLoops[i];
+		len = sprintf(line, "%06X %d %d %u %llu\n", (unsigned int)loop->PC, loop->Mode,
+			loop->Period, (unsigned int)loop->Hits, (unsigned long long)loop->Skipped);
+#ifndef TARGET_GNW
+		filestream_write(fo, line, len);
+#else
+		fwrite(line, 1, len, fo);
+#endif
 	}
 
-	// Read State Structure
-	PMiniStr[4] = 0;
-	while (memstream_pos(stream) < size) {
-		readbytes = memstream_read(stream, PMiniStr, 4);
-		if (readbytes != 4) {
-			memstream_close(stream);
-			memstream_set_buffer(NULL, 0);
-			return 0;
+#ifndef TARGET_GNW
+	filestream_close(fo);
+#else
+	fclose(fo);
+#endif
+
+	return 1;
+}
+
+#ifndef TARGET_GNW
+// Savestate chunks
+//   Each chunk is stored as tag, payload size and payload. PokeMini_ID2
+//   states also have an index after the header with offset, size and CRC32
+//   of every payload, so chunks can be checked and found without parsing
+//   the ones before them. Unknown chunks are skipped
+//   PokeMini_ID3 (compact) states leave out chunks still at power-on state
+//   and pack each payload as a list of varint tokens h, followed by one
+//   byte repeated h>>1 times if h is odd or by h>>1 literal bytes if even.
+//   The raw size is kept before the packed payload, index sizes and CRCs
+//   are of the packed payload
+typedef int TPokeMini_SSLoad(TPokeMini_Stream *stream, uint32_t bsize);
+typedef int TPokeMini_SSSave(TPokeMini_Stream *stream);
+typedef int TPokeMini_SSInUse(void);
+typedef void TPokeMini_SSClear(void);
+
+// Largest raw chunk in a compact state
+#define POKEMINI_SS_RAWMAX	0x8000
+
+static int PokeMini_LoadRAMStream(TPokeMini_Stream *stream, uint32_t bsize)
+{
+	if (bsize != 0x1000) return 0;
+	MinxCPU_DirtyRAM = 0xFFFF;
+	return PokeMini_StreamRead(stream, PM_RAM, 0x1000) == 0x1000;
+}
+
+static int PokeMini_SaveRAMStream(TPokeMini_Stream *stream)
+{
+	uint32_t BSize = 0x1000;
+	if (PokeMini_StreamWrite(stream, &BSize, 4) != 4) return 0;
+	return PokeMini_StreamWrite(stream, PM_RAM, 0x1000) == 0x1000;
+}
+
+static int PokeMini_LoadREGStream(TPokeMini_Stream *stream, uint32_t bsize)
+{
+	if (bsize != 256) return 0;
+	return PokeMini_StreamRead(stream, PM_IO, 256) == 256;
+}
+
+static int PokeMini_SaveREGStream(TPokeMini_Stream *stream)
+{
+	uint32_t BSize = 256;
+	if (PokeMini_StreamWrite(stream, &BSize, 4) != 4) return 0;
+	return PokeMini_StreamWrite(stream, PM_IO, 256) == 256;
+}
+
+static const struct {
+	char tag[4];
+	uint32_t size;			// Payload size, loaders reject any other
+	TPokeMini_SSLoad *load;
+	TPokeMini_SSSave *save;
+	TPokeMini_SSInUse *inuse;	// NULL if always saved in compact states
+	TPokeMini_SSClear *clear;	// Power-on state when left out
+} PokeMini_SSChunks[POKEMINI_SS_CHUNKS] = {
+	{ {'R','A','M','-'}, 0x1000, PokeMini_LoadRAMStream, PokeMini_SaveRAMStream, NULL, NULL },		// RAM
+	{ {'R','E','G','-'}, 256, PokeMini_LoadREGStream, PokeMini_SaveREGStream, NULL, NULL },		// Register I/O
+	{ {'C','P','U','-'}, 64, MinxCPU_LoadStateStream, MinxCPU_SaveStateStream, NULL, NULL },	// CPU
+	{ {'I','R','Q','-'}, 1, MinxIRQ_LoadStateStream, MinxIRQ_SaveStateStream, NULL, NULL },	// IRQ
+	{ {'T','M','R','-'}, 128, MinxTimers_LoadStateStream, MinxTimers_SaveStateStream, NULL, NULL },	// Timers
+	{ {'P','I','O','-'}, 32+8192, MinxIO_LoadStateStream, MinxIO_SaveStateStream, NULL, NULL },		// Parallel IO
+	{ {'P','R','C','-'}, 1+32, MinxPRC_LoadStateStream, MinxPRC_SaveStateStream, NULL, NULL },	// PRC
+	{ {'C','P','M','-'}, 16384+32, MinxColorPRC_LoadStateStream, MinxColorPRC_SaveStateStream,
+	  MinxColorPRC_InUse, MinxColorPRC_ClearState },	// Color PRC
+	{ {'L','C','D','-'}, 256*9 + 96*64 + 96*64 + 64, MinxLCD_LoadStateStream, MinxLCD_SaveStateStream, NULL, NULL },	// LCD
+	{ {'A','U','D','-'}, 32, MinxAudio_LoadStateStream, MinxAudio_SaveStateStream, NULL, NULL },	// Audio
+};
+
+// Check payload size of a chunk, unknown ones can have any size
+static int PokeMini_CheckSSChunk(const char *tag, uint32_t bsize)
+{
+	int i;
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		if (!memcmp(tag, PokeMini_SSChunks[i].tag, 4)) return bsize == PokeMini_SSChunks[i].size;
+	}
+	return 1;
+}
+
+// Load one chunk payload, skip it if the tag is unknown
+static int PokeMini_LoadSSChunk(TPokeMini_Stream *stream, const char *tag, uint32_t bsize)
+{
+	int i;
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		if (!memcmp(tag, PokeMini_SSChunks[i].tag, 4)) return PokeMini_SSChunks[i].load(stream, bsize);
+	}
+	return !PokeMini_StreamSkip(stream, bsize);
+}
+
+// Write one packed token, run is 1 for a repeated byte
+static int PokeMini_SSPackToken(TPokeMini_Stream *stream, const uint8_t *data, uint32_t len, int run)
+{
+	uint8_t head[5];
+	uint32_t hlen, dlen = run ? 1 : len;
+
+	if (!len) return 1;
+	hlen = (uint32_t)(PokeMini_PutVarint(head, (len << 1) | run) - head);
+	if (PokeMini_StreamWrite(stream, head, hlen) != hlen) return 0;
+	return PokeMini_StreamWrite(stream, data, dlen) == dlen;
+}
+
+// Pack payload, runs shorter than 4 bytes stay literal
+static int PokeMini_SSPack(TPokeMini_Stream *stream, const uint8_t *data, uint32_t size)
+{
+	uint32_t pos = 0, start = 0, run;
+
+	while (pos < size) {
+		for (run = 1; (pos + run < size) && (data[pos + run] == data[pos]); run++);
+		if (run < 4) {
+			pos += run;
+			continue;
 		}
-		readbytes = memstream_read(stream, &BSize, 4);
-		if (readbytes != 4) {
-			memstream_close(stream);
-			memstream_set_buffer(NULL, 0);
-			return 0;
+		if (!PokeMini_SSPackToken(stream, data + start, pos - start, 0)) return 0;
+		if (!PokeMini_SSPackToken(stream, data + pos, run, 1)) return 0;
+		pos += run;
+		start = pos;
+	}
+	return PokeMini_SSPackToken(stream, data + start, pos - start, 0);
+}
+
+// Unpack payload, fails unless it fills exactly size bytes
+static int PokeMini_SSUnpack(uint8_t *data, uint32_t size, const uint8_t *in, uint32_t len)
+{
+	const uint8_t *end = in + len;
+	uint32_t pos = 0, h, n;
+
+	while (in < end) {
+		in = PokeMini_GetVarint(in, end, &h);
+		if (!in) return 0;
+		n = h >> 1;
+		if (n > size - pos) return 0;
+		if (h & 1) {
+			if (in >= end) return 0;
+			memset(data + pos, *in++, n);
+		} else {
+			if (n > (uint32_t)(end - in)) return 0;
+			memcpy(data + pos, in, n);
+			in += n;
 		}
-		if (!strcmp(PMiniStr, "RAM-")) {		// RAM
-			readbytes = memstream_read(stream, PM_RAM, 0x1000);
-			if ((BSize != 0x1000) || (readbytes != 0x1000)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "REG-")) {		// Register I/O
-			readbytes = memstream_read(stream, PM_IO, 256);
-			if ((BSize != 256) || (readbytes != 256)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "CPU-")) {		// CPU
-			if (!MinxCPU_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "IRQ-")) {		// IRQ
-			if (!MinxIRQ_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "TMR-")) {		// Timers
-			if (!MinxTimers_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "PIO-")) {		// Parallel IO
-			if (!MinxIO_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "PRC-")) {		// PRC
-			if (!MinxPRC_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "CPM-")) {		// Color PRC
-			if (!MinxColorPRC_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "LCD-")) {		// LCD
-			if (!MinxLCD_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
-				return 0;
-			}
-		} else if (!strcmp(PMiniStr, "AUD-")) {		// Audio
-			if (!MinxAudio_LoadStateStream(stream, BSize)) {
-				memstream_close(stream);
-				memstream_set_buffer(NULL, 0);
+		pos += n;
+	}
+	return pos == size;
+}
+
+// Load one compact chunk from the index
+static int PokeMini_LoadSSChunkCompact(uint8_t *buffer, uint8_t *raw, const TPokeMini_SSChunk *chunk)
+{
+	TPokeMini_Stream rstream;
+	uint32_t BSize;
+
+	if (chunk->Offset < 4) return 0;
+	memcpy(&BSize, buffer + chunk->Offset - 4, 4);
+	if (BSize > POKEMINI_SS_RAWMAX) return 0;
+	if (!PokeMini_SSUnpack(raw, BSize, buffer + chunk->Offset, chunk->Size)) return 0;
+	PokeMini_StreamOpen(&rstream, raw, BSize);
+	return PokeMini_LoadSSChunk(&rstream, chunk->Tag, BSize);
+}
+
+// Check a compact chunk unpacks to the size its loader takes
+static int PokeMini_CheckSSChunkCompact(uint8_t *buffer, uint8_t *raw, const TPokeMini_SSChunk *chunk)
+{
+	uint32_t BSize;
+
+	if (chunk->Offset < 4) return 0;
+	memcpy(&BSize, buffer + chunk->Offset - 4, 4);
+	if ((BSize > POKEMINI_SS_RAWMAX) || !PokeMini_CheckSSChunk(chunk->Tag, BSize)) return 0;
+	return PokeMini_SSUnpack(raw, BSize, buffer + chunk->Offset, chunk->Size);
+}
+
+// Check savestate header, chunk sizes and CRCs
+//   Once this passes no chunk can fail to load, so a bad state is
+//   rejected before anything is changed
+int PokeMini_CheckSSStream(uint8_t *buffer, uint64_t size)
+{
+	TPokeMini_Stream sstream, *stream = &sstream;
+	TPokeMini_SSChunk chunk;
+	char PMiniStr[4];
+	uint32_t PMiniID, StatTime, BSize, Count, i;
+	uint8_t *raw = NULL;
+	int ok = 1;
+
+	PokeMini_StreamOpen(stream, buffer, size);
+	if ((size < 24) || memcmp(buffer, "PokeMiniStat", 12)) return 0;
+	PokeMini_StreamSkip(stream, 12);
+	PokeMini_StreamRead(stream, &PMiniID, 4);
+	PokeMini_StreamRead(stream, &StatTime, 4);
+	if (PMiniID == PokeMini_ID) {
+		// No index, walk the chunks in sequence
+		while (stream->ptr < size) {
+			if (size - stream->ptr < 8) return 0;
+			PokeMini_StreamRead(stream, PMiniStr, 4);
+			PokeMini_StreamRead(stream, &BSize, 4);
+			if (!memcmp(PMiniStr, "END-", 4)) break;
+			if ((BSize > size - stream->ptr) || !PokeMini_CheckSSChunk(PMiniStr, BSize)) return 0;
+			PokeMini_StreamSkip(stream, BSize);
+		}
+		return 1;
+	}
+	if ((PMiniID != PokeMini_ID2) && (PMiniID != PokeMini_ID3)) return 0;
+	if (PokeMini_StreamRead(stream, &Count, 4) != 4) return 0;
+	if (Count > (size - stream->ptr) / sizeof(TPokeMini_SSChunk)) return 0;
+	if (PMiniID == PokeMini_ID3) {
+		raw = (uint8_t *)malloc(POKEMINI_SS_RAWMAX);
+		if (!raw) return 0;
+	}
+	for (i=0; ok && (i<Count); i++) {
+		PokeMini_StreamRead(stream, &chunk, sizeof(TPokeMini_SSChunk));
+		if ((chunk.Offset > size) || (chunk.Size > size - chunk.Offset)) ok = 0;
+		else if (PokeMini_CRC32(0, buffer + chunk.Offset, chunk.Size) != chunk.CRC) ok = 0;
+		else if (raw) ok = PokeMini_CheckSSChunkCompact(buffer, raw, &chunk);
+		else ok = PokeMini_CheckSSChunk(chunk.Tag, chunk.Size);
+	}
+	if (raw) free(raw);
+	return ok;
+}
+
+// Load emulator state from memory stream
+int PokeMini_LoadSSStream(uint8_t *buffer, uint64_t size)
+{
+	TPokeMini_Stream sstream, *stream = &sstream;
+	TPokeMini_SSChunk chunk;
+	int readbytes;
+	char PMiniStr[PMTMPV];
+	uint32_t PMiniID, StatTime, BSize, Count, Index, i;
+	uint8_t *raw;
+
+	// Check everything before anything is loaded
+	if (!PokeMini_CheckSSStream(buffer, size)) return 0;
+
+	// Open memory stream
+	PokeMini_StreamOpen(stream, buffer, size);
+	PokeMini_StreamSkip(stream, 12);
+	PokeMini_StreamRead(stream, &PMiniID, 4);
+	PokeMini_StreamRead(stream, &StatTime, 4);
+
+	if (PMiniID == PokeMini_ID2) {
+		// Go through the index
+		PokeMini_StreamRead(stream, &Count, 4);
+		Index = (uint32_t)stream->ptr;
+		for (i=0; i<Count; i++) {
+			stream->ptr = Index + i * sizeof(TPokeMini_SSChunk);
+			PokeMini_StreamRead(stream, &chunk, sizeof(TPokeMini_SSChunk));
+			stream->ptr = chunk.Offset;
+			if (!PokeMini_LoadSSChunk(stream, chunk.Tag, chunk.Size)) return 0;
+		}
+	} else if (PMiniID == PokeMini_ID3) {
+		// Chunks left out are at power-on state
+		raw = (uint8_t *)malloc(POKEMINI_SS_RAWMAX);
+		if (!raw) return 0;
+		for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+			if (PokeMini_SSChunks[i].clear) PokeMini_SSChunks[i].clear();
+		}
+		PokeMini_StreamRead(stream, &Count, 4);
+		Index = (uint32_t)stream->ptr;
+		for (i=0; i<Count; i++) {
+			memcpy(&chunk, buffer + Index + i * sizeof(TPokeMini_SSChunk), sizeof(TPokeMini_SSChunk));
+			if (!PokeMini_LoadSSChunkCompact(buffer, raw, &chunk)) {
+				free(raw);
 				return 0;
 			}
-		} else if (!strcmp(PMiniStr, "END-")) {
-			break;
+		}
+		free(raw);
+	} else {
+		// Read chunks in sequence
+		while (stream->ptr < size) {
+			readbytes = PokeMini_StreamRead(stream, PMiniStr, 4);
+			if (readbytes != 4) return 0;
+			readbytes = PokeMini_StreamRead(stream, &BSize, 4);
+			if (readbytes != 4) return 0;
+			if (!memcmp(PMiniStr, "END-", 4)) break;
+			if (!PokeMini_LoadSSChunk(stream, PMiniStr, BSize)) return 0;
 		}
 	}
-	memstream_close(stream);
-	memstream_set_buffer(NULL, 0);
 
 	// Update RTC if requested
 	if (CommandLine.updatertc == 1)
@@ -510,6 +876,7 @@ int PokeMini_LoadSSStream(const char *filename, uint64_t size)
 			return 0;
 		}
 		if (!strcmp(PMiniStr, "RAM-")) {		// RAM
+			MinxCPU_DirtyRAM = 0xFFFF;
 			readbytes = fread(PM_RAM, 1, 0x1000, file);
 			if ((BSize != 0x1000) || (readbytes != 0x1000)) {
 				fclose(file);
@@ -582,67 +949,117 @@ int PokeMini_LoadSSStream(const char *filename, uint64_t size)
 /* Save emulator state to memory stream */
 int PokeMini_SaveSSStream(uint8_t *buffer, uint64_t size)
 {
-	/* TODO: Error check bytes written */
-	memstream_t *stream;
-	uint32_t PMiniID, StatTime, BSize;
+	TPokeMini_Stream sstream, *stream = &sstream;
+	TPokeMini_SSChunk index[POKEMINI_SS_CHUNKS];
+	uint32_t PMiniID, StatTime, BSize, Count, Index, i;
 
 	// Open memory stream
-	memstream_set_buffer(buffer, size);
-	stream = memstream_open(1);
-	if (stream == NULL)
-		return 0;
+	PokeMini_StreamOpen(stream, buffer, size);
 
 	// Write content
-	memstream_write(stream, (void *)"PokeMiniStat", 12);	// Write File ID
-	PMiniID = PokeMini_ID;
-	memstream_write(stream, &PMiniID, 4);	// Write State ID
+	PokeMini_StreamWrite(stream, (void *)"PokeMiniStat", 12);	// Write File ID
+	PMiniID = PokeMini_ID2;
+	PokeMini_StreamWrite(stream, &PMiniID, 4);	// Write State ID
 	StatTime = (uint32_t)time(NULL);
-	memstream_write(stream, &StatTime, 4);	// Write Time
-
-	// Read State Structure
-	// - RAM
-	memstream_write(stream, (void *)"RAM-", 4);
-	BSize = 0x1000;
-	memstream_write(stream, &BSize, 4);
-	memstream_write(stream, PM_RAM, 0x1000);
-	// - Registers I/O
-	memstream_write(stream, (void *)"REG-", 4);
-	BSize = 256;
-	memstream_write(stream, &BSize, 4);
-	memstream_write(stream, PM_IO, 256);
-	// - CPU Interface
-	memstream_write(stream, (void *)"CPU-", 4);
-	MinxCPU_SaveStateStream(stream);
-	// - IRQ Interface
-	memstream_write(stream, (void *)"IRQ-", 4);
-	MinxIRQ_SaveStateStream(stream);
-	// - Timers Interface
-	memstream_write(stream, (void *)"TMR-", 4);
-	MinxTimers_SaveStateStream(stream);
-	// - Parallel IO Interface
-	memstream_write(stream, (void *)"PIO-", 4);
-	MinxIO_SaveStateStream(stream);
-	// - PRC Interface
-	memstream_write(stream, (void *)"PRC-", 4);
-	MinxPRC_SaveStateStream(stream);
-	// - Color PRC Interface
-	memstream_write(stream, (void *)"CPM-", 4);
-	MinxColorPRC_SaveStateStream(stream);
-	// - LCD Interface
-	memstream_write(stream, (void *)"LCD-", 4);
-	MinxLCD_SaveStateStream(stream);
-	// - Audio Interface
-	memstream_write(stream, (void *)"AUD-", 4);
-	MinxAudio_SaveStateStream(stream);
+	PokeMini_StreamWrite(stream, &StatTime, 4);	// Write Time
+	Count = POKEMINI_SS_CHUNKS;
+	PokeMini_StreamWrite(stream, &Count, 4);	// Write Index, filled later
+	Index = (uint32_t)stream->ptr;
+	memset(index, 0, sizeof(index));
+	PokeMini_StreamWrite(stream, index, sizeof(index));
+
+	// Write State Structure
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		PokeMini_StreamWrite(stream, PokeMini_SSChunks[i].tag, 4);
+		memcpy(index[i].Tag, PokeMini_SSChunks[i].tag, 4);
+		index[i].Offset = (uint32_t)stream->ptr + 4;	// Payload after size
+		if (!PokeMini_SSChunks[i].save(stream)) return 0;
+		index[i].Size = (uint32_t)stream->ptr - index[i].Offset;
+	}
 	// - EOF
-	memstream_write(stream, (void *)"END-", 4);
+	PokeMini_StreamWrite(stream, (void *)"END-", 4);
 	BSize = 0;
-	memstream_write(stream, &BSize, 4);
-	memstream_close(stream);
-	memstream_set_buffer(NULL, 0);
+	if (PokeMini_StreamWrite(stream, &BSize, 4) != 4) return 0;
+
+	// Fill Index
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		index[i].CRC = PokeMini_CRC32(0, buffer + index[i].Offset, index[i].Size);
+	}
+	size = stream->ptr;
+	stream->ptr = Index;
+	PokeMini_StreamWrite(stream, index, sizeof(index));
+
+	return (int)size;
+}
 
+// Save one compact chunk, raw is scratch for the unpacked payload
+static int PokeMini_SaveSSChunkCompact(TPokeMini_Stream *stream, uint8_t *raw, int i, TPokeMini_SSChunk *chunk)
+{
+	TPokeMini_Stream rstream;
+
+	PokeMini_StreamOpen(&rstream, raw, POKEMINI_SS_RAWMAX);
+	if (!PokeMini_SSChunks[i].save(&rstream)) return 0;
+	PokeMini_StreamWrite(stream, PokeMini_SSChunks[i].tag, 4);
+	if (PokeMini_StreamWrite(stream, raw, 4) != 4) return 0;	// Raw size
+	memcpy(chunk->Tag, PokeMini_SSChunks[i].tag, 4);
+	chunk->Offset = (uint32_t)stream->ptr;
+	if (!PokeMini_SSPack(stream, raw + 4, (uint32_t)rstream.ptr - 4)) return 0;
+	chunk->Size = (uint32_t)stream->ptr - chunk->Offset;
+	chunk->CRC = PokeMini_CRC32(0, stream->buf + chunk->Offset, chunk->Size);
 	return 1;
 }
+
+/* Save compact emulator state to memory stream, return size or 0 */
+int PokeMini_SaveSSStreamCompact(uint8_t *buffer, uint64_t size)
+{
+	TPokeMini_Stream sstream, *stream = &sstream;
+	TPokeMini_SSChunk index[POKEMINI_SS_CHUNKS];
+	uint8_t inuse[POKEMINI_SS_CHUNKS];
+	uint32_t PMiniID, StatTime, BSize, Count, Index, i;
+	uint8_t *raw;
+	int ok = 1;
+
+	// Pick chunks
+	Count = 0;
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		inuse[i] = !PokeMini_SSChunks[i].inuse || PokeMini_SSChunks[i].inuse();
+		if (inuse[i]) Count++;
+	}
+
+	// Open memory stream
+	PokeMini_StreamOpen(stream, buffer, size);
+
+	// Write content
+	PokeMini_StreamWrite(stream, (void *)"PokeMiniStat", 12);	// Write File ID
+	PMiniID = PokeMini_ID3;
+	PokeMini_StreamWrite(stream, &PMiniID, 4);	// Write State ID
+	StatTime = (uint32_t)time(NULL);
+	PokeMini_StreamWrite(stream, &StatTime, 4);	// Write Time
+	PokeMini_StreamWrite(stream, &Count, 4);	// Write Index, filled later
+	Index = (uint32_t)stream->ptr;
+	memset(index, 0, sizeof(index));
+	PokeMini_StreamWrite(stream, index, Count * sizeof(TPokeMini_SSChunk));
+
+	// Write State Structure
+	raw = (uint8_t *)malloc(POKEMINI_SS_RAWMAX);
+	if (!raw) return 0;
+	for (i=0, Count=0; ok && (i<POKEMINI_SS_CHUNKS); i++) {
+		if (inuse[i]) ok = PokeMini_SaveSSChunkCompact(stream, raw, i, &index[Count++]);
+	}
+	free(raw);
+	if (!ok) return 0;
+	// - EOF
+	PokeMini_StreamWrite(stream, (void *)"END-", 4);
+	BSize = 0;
+	if (PokeMini_StreamWrite(stream, &BSize, 4) != 4) return 0;
+
+	// Fill Index
+	size = stream->ptr;
+	stream->ptr = Index;
+	PokeMini_StreamWrite(stream, index, Count * sizeof(TPokeMini_SSChunk));
+
+	return (int)size;
+}
 #else
 /* Save emulator state to memory stream */
 int PokeMini_SaveSSStream(const char *filename, uint64_t size)
@@ -708,6 +1125,104 @@ int PokeMini_SaveSSStream(const char *filename, uint64_t size)
 }
 #endif
 
+// Save machine state into snapshot
+void PokeMini_SaveSnapshot(TPokeMini_Snapshot *snap)
+{
+	snap->ID = POKEMINI_SNAPSHOT_ID;
+	snap->Size = sizeof(TPokeMini_Snapshot);
+
+	// Memory
+	memcpy(snap->RAM, PM_RAM, 0x1100);
+	memcpy(snap->EEPROM, EEPROM, 8192);
+	memcpy(snap->LCDData, LCDData, 256*9);
+	memcpy(snap->LCDPixelsD, LCDPixelsD, 96*64);
+	memcpy(snap->LCDPixelsA, LCDPixelsA, 96*64*2);
+	snap->HasColor = PRCColorMap ? 1 : 0;
+	if (snap->HasColor) memcpy(snap->ColorVMem, PRCColorVMem, 16384);
+
+	// Interfaces
+	snap->CPU = MinxCPU;
+	snap->Timers = MinxTimers;
+	snap->IO = MinxIO;
+	snap->PRC = MinxPRC;
+	snap->ColorPRC = MinxColorPRC;
+	snap->LCD = MinxLCD;
+	snap->Audio = MinxAudio;
+	memcpy(snap->AudioHP, MinxAudio_HPSamples, sizeof(snap->AudioHP));
+	memcpy(snap->AudioLP, MinxAudio_LPSamples, sizeof(snap->AudioLP));
+	snap->HWCycles = PokeHWCycles;
+	snap->MasterIRQ = MinxIRQ_MasterIRQ;
+	snap->StallCPU = StallCPU;
+	snap->LCDDirty = LCDDirty;
+	snap->Rumbling = PokeMini_Rumbling;
+	snap->RumblingLatch = PokeMini_RumblingLatch;
+	snap->ShockKey = PokeMini_ShockKey;
+	snap->LCDReadData = MinxLCD_ReadData;
+
+	// Multicart
+	snap->MMDirty = PM_MM_Dirty;
+	snap->MMBusCycle = PM_MM_BusCycle;
+	snap->MMGetID = PM_MM_GetID;
+	snap->MMBypass = PM_MM_Bypass;
+	snap->MMCommand = PM_MM_Command;
+	snap->MMOffset = PM_MM_Offset;
+	snap->MMLastEraseStart = PM_MM_LastErase_Start;
+	snap->MMLastEraseEnd = PM_MM_LastErase_End;
+	snap->MMLastProg = PM_MM_LastProg;
+}
+
+// Restore machine state from snapshot
+int PokeMini_LoadSnapshot(const TPokeMini_Snapshot *snap)
+{
+	if ((snap->ID != POKEMINI_SNAPSHOT_ID) || (snap->Size != sizeof(TPokeMini_Snapshot))) return 0;
+	if (snap->HasColor != (PRCColorMap ? 1 : 0)) return 0;
+
+	// Memory
+	memcpy(PM_RAM, snap->RAM, 0x1100);
+	memcpy(EEPROM, snap->EEPROM, 8192);
+	memcpy(LCDData, snap->LCDData, 256*9);
+	memcpy(LCDPixelsD, snap->LCDPixelsD, 96*64);
+	memcpy(LCDPixelsA, snap->LCDPixelsA, 96*64*2);
+	if (snap->HasColor) memcpy(PRCColorVMem, snap->ColorVMem, 16384);
+
+	// Interfaces
+	MinxCPU = snap->CPU;
+	MinxTimers = snap->Timers;
+	MinxIO = snap->IO;
+	MinxPRC = snap->PRC;
+	MinxColorPRC = snap->ColorPRC;
+	PRCColorPixels = PRCColorVMem + (MinxColorPRC.ActivePage ? 0x2000 : 0);
+	MinxLCD = snap->LCD;
+	MinxAudio = snap->Audio;
+	memcpy(MinxAudio_HPSamples, snap->AudioHP, sizeof(snap->AudioHP));
+	memcpy(MinxAudio_LPSamples, snap->AudioLP, sizeof(snap->AudioLP));
+	PokeHWCycles = snap->HWCycles;
+	MinxIRQ_MasterIRQ = snap->MasterIRQ;
+	StallCPU = snap->StallCPU;
+	LCDDirty = snap->LCDDirty;
+	PokeMini_Rumbling = snap->Rumbling;
+	PokeMini_RumblingLatch = snap->RumblingLatch;
+	PokeMini_ShockKey = snap->ShockKey;
+	MinxLCD_ReadData = snap->LCDReadData;
+	PokeMini_EEPROMWritten = 1;
+
+	// Multicart
+	PM_MM_Dirty = snap->MMDirty;
+	PM_MM_BusCycle = snap->MMBusCycle;
+	PM_MM_GetID = snap->MMGetID;
+	PM_MM_Bypass = snap->MMBypass;
+	PM_MM_Command = snap->MMCommand;
+	PM_MM_Offset = snap->MMOffset;
+	PM_MM_LastErase_Start = snap->MMLastEraseStart;
+	PM_MM_LastErase_End = snap->MMLastEraseEnd;
+	PM_MM_LastProg = snap->MMLastProg;
+
+	// Idle tracking belongs to the old state, and all RAM pages must be rehashed
+	MinxCPU_Restored();
+
+	return 1;
+}
+
 // Reset emulation
 void PokeMini_Reset(int hardreset)
 {
@@ -716,6 +1231,7 @@ void PokeMini_Reset(int hardreset)
 	{
 		memset(PM_RAM, 0xFF, 8192);
 		memcpy(PM_IO, PM_IO_INIT, 256);
+		MinxCPU_DirtyRAM = 0xFFFF;
 	}
 
 	// Reset all components
@@ -752,4 +1268,7 @@ void PokeMini_Reset(int hardreset)
 	// Set multicart type
 	SetMulticart(CommandLine.multicart);
 #endif
+
+	// Map memory
+	PokeMini_MapMemory();
 }
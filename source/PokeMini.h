@@ -24,13 +24,8 @@
 #ifndef TARGET_GNW
 #include <libretro.h>
 #include <retro_inline.h>
-#include <streams/memory_stream.h>
 #else
 #include <stdio.h>
-#define memstream_t FILE
-#define memstream_read(stream, buffer, size) fread(buffer, 1, size, stream)
-#define memstream_write(stream, buffer, size) fwrite(buffer, 1, size, stream)
-#define memstream_seek(stream, offset, whence) fseek(stream, offset, whence)
 #endif
 
 // Common functions
@@ -40,21 +35,33 @@
 // Generated sound only
 #define POKEMINI_GENSOUND	0x02
 
-extern int PokeMini_FreeBIOS;	// Using freebios?
-extern int PokeMini_Flags;	// Configuration flags
-extern int PokeMini_Rumbling;	// Pokemon-Mini is rumbling
-extern uint8_t PM_BIOS[];	// Pokemon-Mini BIOS ($000000 to $000FFF, 4096)
-extern uint8_t PM_RAM[];	// Pokemon-Mini RAM  ($001000 to $002100, 4096 + 256)
-extern uint8_t *PM_ROM;		// Pokemon-Mini ROM  ($002100 to $1FFFFF, Up to 2MB)
-extern int PM_ROM_Alloc;	// Pokemon-Mini ROM Allocated on memory?
-extern int PM_ROM_Size;		// Pokemon-Mini ROM Size
-extern int PM_ROM_Mask;		// Pokemon-Mini ROM Mask
-extern int PokeMini_LCDMode;	// LCD Mode
-extern int PokeMini_ColorFormat;	// Color Format (0 = 8x8, 1 = 4x4)
-extern int PokeMini_HostBattStatus;	// Host battery status
+extern POKEMINI_TLS int PokeMini_FreeBIOS;	// Using freebios?
+extern POKEMINI_TLS int PokeMini_Flags;	// Configuration flags
+extern POKEMINI_TLS int PokeMini_Rumbling;	// Pokemon-Mini is rumbling
+extern POKEMINI_TLS uint8_t PM_BIOS[];	// Pokemon-Mini BIOS ($000000 to $000FFF, 4096)
+extern POKEMINI_TLS uint8_t PM_RAM[];	// Pokemon-Mini RAM  ($001000 to $002100, 4096 + 256)
+extern POKEMINI_TLS uint8_t *PM_ROM;		// Pokemon-Mini ROM  ($002100 to $1FFFFF, Up to 2MB)
+extern POKEMINI_TLS int PM_ROM_Alloc;	// Pokemon-Mini ROM Allocated on memory?
+extern POKEMINI_TLS int PM_ROM_Size;		// Pokemon-Mini ROM Size
+extern POKEMINI_TLS int PM_ROM_Mask;		// Pokemon-Mini ROM Mask
+extern POKEMINI_TLS int PokeMini_LCDMode;	// LCD Mode
+extern POKEMINI_TLS int PokeMini_ColorFormat;	// Color Format (0 = 8x8, 1 = 4x4)
+extern POKEMINI_TLS int PokeMini_HostBattStatus;	// Host battery status
 
 // Number of cycles to process on hardware
-extern int PokeHWCycles;
+extern POKEMINI_TLS int PokeHWCycles;
+
+// Hidden frame flags, skip output nobody will see
+//   Video also skips PRC rendering into RAM, so it's only for frames whose
+//   state is discarded afterwards, like run-ahead frames before the shown one
+#define POKEMINI_HIDE_VIDEO	0x01	// PRC and LCD rendering, LCD decay
+#define POKEMINI_HIDE_AUDIO	0x02	// Audio samples into the FIFO
+
+extern POKEMINI_TLS int PokeMini_HiddenFrame;
+
+// Set by every refresh that changes the LCD pixels, cleared by the frontend
+//   once the frame is shown, so unchanged frames can be left to repeat
+extern POKEMINI_TLS int PokeMini_LCDUpdated;
 
 #ifndef TARGET_GNW
 extern retro_log_printf_t log_cb;
@@ -105,16 +112,39 @@ static INLINE uint8_t MinxPRC_OnRead(int cpu, uint32_t addr)
 static INLINE void MinxPRC_OnWrite(int cpu, uint32_t addr, uint8_t data)
 {
 	// RAM Write
-	if ((addr >= 0x1000) && (addr < 0x2000))
+	if ((addr >= 0x1000) && (addr < 0x2000)) {
 		PM_RAM[addr-0x1000] = data;
+		MinxCPU_MarkRAM(addr);
+	}
 }
 
 #else
 
 #include "Multicart.h"
 
-#define MinxPRC_OnRead	MinxCPU_OnRead
-#define MinxPRC_OnWrite	MinxCPU_OnWrite
+static INLINE uint8_t MinxPRC_OnRead(int cpu, uint32_t addr)
+{
+	uint8_t *page;
+	if (addr < 0x200000) {
+		page = MinxCPU_ReadPage[addr >> MINX_PAGE_SHIFT];
+		if (page) return page[addr & MINX_PAGE_MASK];
+	}
+	return MinxCPU_OnRead(cpu, addr);
+}
+
+static INLINE void MinxPRC_OnWrite(int cpu, uint32_t addr, uint8_t data)
+{
+	uint8_t *page;
+	if (addr < 0x200000) {
+		page = MinxCPU_WritePage[addr >> MINX_PAGE_SHIFT];
+		if (page) {
+			page[addr & MINX_PAGE_MASK] = data;
+			MinxCPU_MarkRAM(addr);
+			return;
+		}
+	}
+	MinxCPU_OnWrite(cpu, addr, data);
+}
 
 #endif
 
@@ -131,27 +161,25 @@ static INLINE void MinxPRC_OnWrite(int cpu, uint32_t addr, uint8_t data)
 
 // -- Stream versions START
 #define POKELOADSS_STREAM_32(var) {\
-	rsize += (uint32_t)memstream_read(stream, (void *)&tmp32, 4);\
+	rsize += (uint32_t)PokeMini_StreamRead(stream, (void *)&tmp32, 4);\
 	var = tmp32;\
 }
 
 #define POKELOADSS_STREAM_16(var) {\
-	rsize += (uint32_t)memstream_read(stream, (void *)&tmp16, 2);\
+	rsize += (uint32_t)PokeMini_StreamRead(stream, (void *)&tmp16, 2);\
 	var = tmp16;\
 }
 
 #define POKELOADSS_STREAM_8(var) {\
-	rsize += (uint32_t)memstream_read(stream, (void *)&var, 1);\
+	rsize += (uint32_t)PokeMini_StreamRead(stream, (void *)&var, 1);\
 }
 
 #define POKELOADSS_STREAM_A(array, size) {\
-	rsize += (uint32_t)memstream_read(stream, (void *)array, size);\
+	rsize += (uint32_t)PokeMini_StreamRead(stream, (void *)array, size);\
 }
 
-#define POKE_SEEK_CUR 1
-
 #define POKELOADSS_STREAM_X(size) {\
-	rsize += memstream_seek(stream, size, POKE_SEEK_CUR) ? 0 : size;\
+	rsize += PokeMini_StreamSkip(stream, size) ? 0 : size;\
 }
 // -- Stream versions End
 
@@ -165,31 +193,31 @@ static INLINE void MinxPRC_OnWrite(int cpu, uint32_t addr, uint8_t data)
 	uint32_t wsize = 0;\
 	uint32_t tmp32 = size;\
 	uint16_t tmp16;\
-	if (memstream_write(stream, (void *)&tmp32, 4) != 4) return 0;\
+	if (PokeMini_StreamWrite(stream, (void *)&tmp32, 4) != 4) return 0;\
 	{ tmp32 = 0; tmp16 = 0; }
 
 #define POKESAVESS_STREAM_32(var) {\
 	tmp32 = (uint32_t)var;\
-	wsize += (uint32_t)memstream_write(stream, (void *)&tmp32, 4);\
+	wsize += (uint32_t)PokeMini_StreamWrite(stream, (void *)&tmp32, 4);\
 }
 
 #define POKESAVESS_STREAM_16(var) {\
 	tmp16 = (uint16_t)var;\
-	wsize += (uint32_t)memstream_write(stream, (void *)&tmp16, 2);\
+	wsize += (uint32_t)PokeMini_StreamWrite(stream, (void *)&tmp16, 2);\
 }
 
 #define POKESAVESS_STREAM_8(var) {\
-	wsize += (uint32_t)memstream_write(stream, (void *)&var, 1);\
+	wsize += (uint32_t)PokeMini_StreamWrite(stream, (void *)&var, 1);\
 }
 
 #define POKESAVESS_STREAM_A(array, size) {\
-	wsize += (uint32_t)memstream_write(stream, (void *)array, size);\
+	wsize += (uint32_t)PokeMini_StreamWrite(stream, (void *)array, size);\
 }
 
 #define POKESAVESS_STREAM_X(size) {\
 	tmp16 = 0;\
 	for (tmp32=0; tmp32<(uint32_t)size; tmp32++) {\
-		wsize += (uint32_t)memstream_write(stream, (void *)&tmp16, 1);\
+		wsize += (uint32_t)PokeMini_StreamWrite(stream, (void *)&tmp16, 1);\
 	}\
 }
 // -- Stream versions End
@@ -202,12 +230,30 @@ static INLINE void MinxPRC_OnWrite(int cpu, uint32_t addr, uint8_t data)
 // Stream I/O
 typedef int TPokeMini_StreamIO(void *data, int size, void *ptr);
 
+// Emulator instance
+//   Core state is global, a context keeps the state of one instance while
+//   another is selected. Until a context is selected the default instance
+//   runs, selecting NULL goes back to it
+typedef struct TPokeMini_Context TPokeMini_Context;
+
 // Create emulator and all interfaces
 int PokeMini_Create(int flags, int soundfifo);
 
 // Destroy emulator and all interfaces
 void PokeMini_Destroy(void);
 
+// New instance context, select it and call PokeMini_Create() to use it
+TPokeMini_Context *PokeMini_NewContext(void);
+
+// Destroy the instance on a context and free it
+void PokeMini_FreeContext(TPokeMini_Context *ctx);
+
+// Select the instance to run, return 1 on success
+int PokeMini_SelectContext(TPokeMini_Context *ctx);
+
+// Selected instance, NULL for the default one
+TPokeMini_Context *PokeMini_GetContext(void);
+
 // Apply changes from command lines
 void PokeMini_ApplyChanges(void);
 
@@ -241,12 +287,39 @@ int PokeMini_LoadEEPROMFile(const char *filename);
 // Save EEPROM data
 int PokeMini_SaveEEPROMFile(const char *filename);
 
+// Load idle loops white/blacklist
+int PokeMini_LoadIdleFile(const char *filename);
+
+// Save idle loops report
+int PokeMini_SaveIdleFile(const char *filename);
+
 #ifndef TARGET_GNW
+// Savestate index entry
+typedef struct {
+	char Tag[4];		// Chunk tag ("RAM-", "CPU-", ...)
+	uint32_t Offset;	// Payload offset in the state
+	uint32_t Size;		// Payload size
+	uint32_t CRC;		// Payload CRC32
+} TPokeMini_SSChunk;
+
+// Number of chunks in a savestate
+#define POKEMINI_SS_CHUNKS	10
+
+// Check savestate integrity without loading it
+int PokeMini_CheckSSStream(uint8_t *buffer, uint64_t size);
+
 // Load emulator state from memory stream
 int PokeMini_LoadSSStream(uint8_t *buffer, uint64_t size);
 
 // Save emulator state to memory stream
+//   Returns bytes written or 0 if it doesn't fit
 int PokeMini_SaveSSStream(uint8_t *buffer, uint64_t size);
+
+// Save compact emulator state to memory stream
+//   Chunks still at power-on state are left out and payloads are packed,
+//   so the size depends on the state. Returns bytes written or 0 if it
+//   doesn't fit, PokeMini_LoadSSStream loads it
+int PokeMini_SaveSSStreamCompact(uint8_t *buffer, uint64_t size);
 #else
 // Load emulator state from memory stream
 int PokeMini_LoadSSStream(const char *filename, uint64_t size);
@@ -255,9 +328,68 @@ int PokeMini_LoadSSStream(const char *filename, uint64_t size);
 int PokeMini_SaveSSStream(const char *filename, uint64_t size);
 #endif
 
+// Raw machine state snapshot
+//   Plain copy of the running state for rewind, run-ahead and search, only
+//   valid on the same build with the same ROM. ROM, BIOS and configuration
+//   aren't included, neither is the audio FIFO
+#define POKEMINI_SNAPSHOT_ID	0x534D4B50	// "PKMS"
+
+typedef struct {
+	uint32_t ID;			// POKEMINI_SNAPSHOT_ID
+	uint32_t Size;			// sizeof(TPokeMini_Snapshot)
+
+	// Memory
+	uint8_t RAM[0x1100];		// RAM and I/O registers
+	uint8_t EEPROM[8192];
+	uint8_t LCDData[256*9];
+	uint8_t LCDPixelsD[96*64];
+	uint8_t LCDPixelsA[96*64*2];	// Analog and 3 shades history
+	uint8_t ColorVMem[16384];	// Only with color information
+
+	// Interfaces
+	TMinxCPU CPU;
+	TMinxTimers Timers;
+	TMinxIO IO;
+	TMinxPRC PRC;
+	TMinxColorPRC ColorPRC;
+	TMinxLCD LCD;
+	TMinxAudio Audio;
+	int32_t AudioHP[4];
+	int32_t AudioLP[4];
+	int HWCycles;
+	int MasterIRQ;
+	int StallCPU;
+	int LCDDirty;
+	int Rumbling;
+	int RumblingLatch;
+	int ShockKey;
+	uint8_t LCDReadData;
+	uint8_t HasColor;
+
+	// Multicart
+	int MMDirty;
+	int MMBusCycle;
+	int MMGetID;
+	int MMBypass;
+	int MMCommand;
+	uint32_t MMOffset;
+	uint32_t MMLastEraseStart;
+	uint32_t MMLastEraseEnd;
+	uint32_t MMLastProg;
+} TPokeMini_Snapshot;
+
+// Save machine state into snapshot
+void PokeMini_SaveSnapshot(TPokeMini_Snapshot *snap);
+
+// Restore machine state from snapshot
+int PokeMini_LoadSnapshot(const TPokeMini_Snapshot *snap);
+
 // Reset CPU
 void PokeMini_Reset(int hardreset);
 
+// Rebuild CPU memory page table
+void PokeMini_MapMemory(void);
+
 // Internals, do not call directly!
 void PokeMini_FreeColorInfo(void);
 
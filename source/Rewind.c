@@ -0,0 +1,198 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "PokeMini.h"
+#include "Rewind.h"
+
+// Each frame is stored in the ring as [length][encoded delta][length], the
+// leading length lets the oldest entry be dropped, the trailing one lets the
+// newest be popped. The delta is a list of (unchanged count, changed count,
+// changed bytes) with counts in 7-bit varint form
+
+// Encode a ^ b, return encoded size
+static uint32_t PokeMini_RewindEncode(uint8_t *out, const uint8_t *a, const uint8_t *b, uint32_t size)
+{
+	uint8_t *start = out;
+	uint32_t pos = 0, zeros, lits, run;
+	uint64_t wa, wb;
+
+	while (pos < size) {
+		// Unchanged bytes, skip whole words first
+		zeros = pos;
+		while (pos + 8 <= size) {
+			memcpy(&wa, a + pos, 8);
+			memcpy(&wb, b + pos, 8);
+			if (wa != wb) break;
+			pos += 8;
+		}
+		while ((pos < size) && (a[pos] == b[pos])) pos++;
+		if (pos >= size) break;
+		zeros = pos - zeros;
+
+		// Changed bytes, until 4 unchanged in a row
+		lits = pos;
+		run = 0;
+		while ((pos < size) && (run < 4)) {
+			run = (a[pos] == b[pos]) ? run + 1 : 0;
+			pos++;
+		}
+		pos -= run;
+		lits = pos - lits;
+
+		out = PokeMini_PutVarint(out, zeros);
+		out = PokeMini_PutVarint(out, lits);
+		for (pos -= lits; lits; lits--, pos++) *out++ = a[pos] ^ b[pos];
+	}
+	return (uint32_t)(out - start);
+}
+
+// Apply encoded delta over dst
+static void PokeMini_RewindDecode(uint8_t *dst, const uint8_t *in, uint32_t len)
+{
+	const uint8_t *end = in + len;
+	uint32_t zeros, lits;
+
+	while (in < end) {
+		in = PokeMini_GetVarint(in, end, &zeros);
+		in = PokeMini_GetVarint(in, end, &lits);
+		dst += zeros;
+		while (lits--) *dst++ ^= *in++;
+	}
+}
+
+// Ring access with wrap around
+static void PokeMini_RewindWrite(TPokeMini_Rewind *rw, uint32_t offs, const uint8_t *src, uint32_t len)
+{
+	uint32_t part = rw->Size - offs;
+	if (part > len) part = len;
+	memcpy(rw->Ring + offs, src, part);
+	memcpy(rw->Ring, src + part, len - part);
+}
+
+static void PokeMini_RewindRead(TPokeMini_Rewind *rw, uint32_t offs, uint8_t *dst, uint32_t len)
+{
+	uint32_t part = rw->Size - offs;
+	if (part > len) part = len;
+	memcpy(dst, rw->Ring + offs, part);
+	memcpy(dst + part, rw->Ring, len - part);
+}
+
+TPokeMini_Rewind *PokeMini_RewindCreate(uint32_t size)
+{
+	TPokeMini_Rewind *rw;
+
+	if (size < 64) return NULL;
+	rw = (TPokeMini_Rewind *)calloc(1, sizeof(TPokeMini_Rewind));
+	if (!rw) return NULL;
+	rw->Size = size;
+	rw->Ring = (uint8_t *)malloc(size);
+	// Worst case is one changed byte every 5, 2 bytes of overhead each
+	rw->Scratch = (uint8_t *)malloc(sizeof(TPokeMini_Snapshot) * 2 + 16);
+	// Zeroed so struct padding never shows in the deltas
+	rw->Newest = (TPokeMini_Snapshot *)calloc(1, sizeof(TPokeMini_Snapshot));
+	rw->Next = (TPokeMini_Snapshot *)calloc(1, sizeof(TPokeMini_Snapshot));
+	if (!rw->Ring || !rw->Scratch || !rw->Newest || !rw->Next) {
+		PokeMini_RewindDestroy(rw);
+		return NULL;
+	}
+	return rw;
+}
+
+void PokeMini_RewindDestroy(TPokeMini_Rewind *rw)
+{
+	if (!rw) return;
+	free(rw->Ring);
+	free(rw->Scratch);
+	free(rw->Newest);
+	free(rw->Next);
+	free(rw);
+}
+
+void PokeMini_RewindClear(TPokeMini_Rewind *rw)
+{
+	rw->Head = 0;
+	rw->Used = 0;
+	rw->Frames = 0;
+	rw->HasNewest = 0;
+}
+
+void PokeMini_RewindPush(TPokeMini_Rewind *rw)
+{
+	TPokeMini_Snapshot *prev;
+	uint32_t len, need, tail, old;
+
+	PokeMini_SaveSnapshot(rw->Next);
+	prev = rw->Newest;
+	rw->Newest = rw->Next;
+	rw->Next = prev;
+	if (!rw->HasNewest) {
+		rw->HasNewest = 1;
+		return;
+	}
+
+	// Delta that takes the new frame back to the previous one
+	len = PokeMini_RewindEncode(rw->Scratch + 4, (const uint8_t *)prev,
+		(const uint8_t *)rw->Newest, sizeof(TPokeMini_Snapshot));
+	need = len + 8;
+	rw->PushedFrames++;
+	rw->PushedBytes += need;
+	if (need > rw->Size) {
+		// Doesn't fit at all, history before this frame is lost
+		rw->Head = 0;
+		rw->Used = 0;
+		rw->Frames = 0;
+		return;
+	}
+
+	// Drop oldest frames until there's room
+	while (rw->Used + need > rw->Size) {
+		tail = (rw->Head + rw->Size - rw->Used) % rw->Size;
+		PokeMini_RewindRead(rw, tail, (uint8_t *)&old, 4);
+		rw->Used -= old + 8;
+		rw->Frames--;
+	}
+
+	memcpy(rw->Scratch, &len, 4);
+	memcpy(rw->Scratch + 4 + len, &len, 4);
+	PokeMini_RewindWrite(rw, rw->Head, rw->Scratch, need);
+	rw->Head = (rw->Head + need) % rw->Size;
+	rw->Used += need;
+	rw->Frames++;
+}
+
+int PokeMini_RewindStep(TPokeMini_Rewind *rw)
+{
+	uint32_t len, start;
+	int res = 0;
+
+	if (!rw->HasNewest) return 0;
+	if (rw->Frames) {
+		PokeMini_RewindRead(rw, (rw->Head + rw->Size - 4) % rw->Size, (uint8_t *)&len, 4);
+		start = (rw->Head + rw->Size - (len + 8)) % rw->Size;
+		PokeMini_RewindRead(rw, (start + 4) % rw->Size, rw->Scratch, len);
+		PokeMini_RewindDecode((uint8_t *)rw->Newest, rw->Scratch, len);
+		rw->Head = start;
+		rw->Used -= len + 8;
+		rw->Frames--;
+		res = 1;
+	}
+	PokeMini_LoadSnapshot(rw->Newest);
+	return res;
+}
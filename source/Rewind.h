@@ -0,0 +1,67 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_REWIND
+#define POKEMINI_REWIND
+
+#include <stdint.h>
+#include "PokeMini.h"
+
+// Rewind buffer
+//   Keeps the newest snapshot in full and, for each older frame, the XOR
+//   between it and the following one. Deltas are run-length encoded and
+//   stored in a bounded ring, oldest frames are dropped when it's full
+typedef struct {
+	uint8_t *Ring;			// Encoded deltas
+	uint8_t *Scratch;		// Encoding / decoding space
+	uint32_t Size;			// Ring size in bytes
+	uint32_t Head;			// Next write offset
+	uint32_t Used;			// Bytes in use
+	int Frames;			// Deltas stored
+	int HasNewest;			// Newest is valid
+	TPokeMini_Snapshot *Newest;	// State of the last pushed frame
+	TPokeMini_Snapshot *Next;	// Capture space
+
+	// Statistics
+	uint32_t PushedFrames;		// Deltas encoded
+	uint64_t PushedBytes;		// Bytes taken by those deltas
+} TPokeMini_Rewind;
+
+// Create rewind buffer of size bytes, NULL on failure
+TPokeMini_Rewind *PokeMini_RewindCreate(uint32_t size);
+
+// Destroy rewind buffer
+void PokeMini_RewindDestroy(TPokeMini_Rewind *rw);
+
+// Drop all history, call after reset or state load
+void PokeMini_RewindClear(TPokeMini_Rewind *rw);
+
+// Record current machine state, call once per emulated frame
+void PokeMini_RewindPush(TPokeMini_Rewind *rw);
+
+// Restore previous frame, return 0 when no older frame is available
+int PokeMini_RewindStep(TPokeMini_Rewind *rw);
+
+// Average bytes stored per frame
+static INLINE double PokeMini_RewindBytesPerFrame(TPokeMini_Rewind *rw)
+{
+	if (!rw->PushedFrames) return 0.0;
+	return (double)rw->PushedBytes / (double)rw->PushedFrames;
+}
+
+#endif
@@ -0,0 +1,161 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "PokeMini.h"
+#include "StateHash.h"
+
+#ifndef TARGET_GNW
+// Chunks are the savestate ones. Small chunks are hashed from what their
+// module saves, large ones from their arrays in place
+
+static const char PokeMini_HashTags[POKEMINI_SS_CHUNKS][5] = {
+	"RAM-", "REG-", "CPU-", "IRQ-", "TMR-", "PIO-", "PRC-", "CPM-", "LCD-", "AUD-"
+};
+
+// RAM page hashes, valid unless the page bit is in MinxCPU_DirtyRAM
+static POKEMINI_TLS uint64_t PokeMini_HashRAMPage[16];
+
+#define POKEMINI_HASH_SEED	0xCBF29CE484222325ULL
+#define POKEMINI_HASH_MUL	0x9E3779B97F4A7C15ULL
+
+#define POKEMINI_HASH_STEP(h, p) {\
+	uint64_t w;\
+	memcpy(&w, p, 8);\
+	h = (h ^ w) * POKEMINI_HASH_MUL;\
+	h ^= h >> 29;\
+}
+
+// Hash 8 bytes at a time, in four independent lanes for long runs
+static uint64_t PokeMini_Hash(uint64_t h, const void *data, uint32_t size)
+{
+	const uint8_t *p = (const uint8_t *)data;
+	uint64_t l0, l1, l2, l3;
+	uint8_t tail[8];
+
+	if (size >= 32) {
+		l0 = h; l1 = h + 1; l2 = h + 2; l3 = h + 3;
+		for (; size >= 32; size -= 32, p += 32) {
+			POKEMINI_HASH_STEP(l0, p);
+			POKEMINI_HASH_STEP(l1, p + 8);
+			POKEMINI_HASH_STEP(l2, p + 16);
+			POKEMINI_HASH_STEP(l3, p + 24);
+		}
+		h = l0;
+		POKEMINI_HASH_STEP(h, &l1);
+		POKEMINI_HASH_STEP(h, &l2);
+		POKEMINI_HASH_STEP(h, &l3);
+	}
+	for (; size >= 8; size -= 8, p += 8) POKEMINI_HASH_STEP(h, p);
+	if (size) {
+		memset(tail, 0, 8);
+		memcpy(tail, p, size);
+		POKEMINI_HASH_STEP(h, tail);
+	}
+	return h;
+}
+
+// Hash a small chunk through its savestate writer
+static uint64_t PokeMini_HashSaved(int (*save)(TPokeMini_Stream *stream))
+{
+	TPokeMini_Stream stream;
+	uint8_t buf[160];
+
+	PokeMini_StreamOpen(&stream, buf, sizeof(buf));
+	if (!save(&stream)) return 0;
+	return PokeMini_Hash(POKEMINI_HASH_SEED, buf, (uint32_t)stream.ptr);
+}
+
+// Struct bytes up to the end of the last field, padding isn't state
+#define POKEMINI_HASH_UPTO(type, last)	(uint32_t)(offsetof(type, last) + sizeof(((type *)0)->last))
+
+uint64_t PokeMini_StateHash(TPokeMini_StateHash *dump)
+{
+	uint64_t chunk[POKEMINI_SS_CHUNKS];
+	uint64_t h;
+	uint16_t dirty = MinxCPU_DirtyRAM;
+	int i;
+
+	// RAM, dirty pages only
+	MinxCPU_DirtyRAM = 0;
+	for (i=0; i<16; i++) {
+		if (dirty & (1 << i)) {
+			PokeMini_HashRAMPage[i] = PokeMini_Hash(POKEMINI_HASH_SEED, PM_RAM + (i << 8), 256);
+		}
+	}
+	chunk[0] = PokeMini_Hash(POKEMINI_HASH_SEED, PokeMini_HashRAMPage, sizeof(PokeMini_HashRAMPage));
+
+	// Registers and small chunks
+	chunk[1] = PokeMini_Hash(POKEMINI_HASH_SEED, PM_IO, 256);
+	chunk[2] = PokeMini_HashSaved(MinxCPU_SaveStateStream);
+	chunk[3] = PokeMini_HashSaved(MinxIRQ_SaveStateStream);
+	chunk[4] = PokeMini_HashSaved(MinxTimers_SaveStateStream);
+	chunk[6] = PokeMini_HashSaved(MinxPRC_SaveStateStream);
+	chunk[9] = PokeMini_HashSaved(MinxAudio_SaveStateStream);
+
+	// Parallel IO and EEPROM
+	h = PokeMini_Hash(POKEMINI_HASH_SEED, &MinxIO, POKEMINI_HASH_UPTO(TMinxIO, EEPAddress));
+	chunk[5] = PokeMini_Hash(h, EEPROM, 8192);
+
+	// Color PRC, nothing while at power-on state
+	chunk[7] = 0;
+	if (MinxColorPRC_InUse()) {
+		h = PokeMini_Hash(POKEMINI_HASH_SEED, &MinxColorPRC, sizeof(TMinxColorPRC));
+		chunk[7] = PokeMini_Hash(h, PRCColorVMem, 16384);
+	}
+
+	// LCD controller, not the rendered pixels
+	h = PokeMini_Hash(POKEMINI_HASH_SEED, &MinxLCD, POKEMINI_HASH_UPTO(TMinxLCD, RMWColumn));
+	chunk[8] = PokeMini_Hash(h, LCDData, 256*9);
+
+	h = PokeMini_Hash(POKEMINI_HASH_SEED, chunk, sizeof(chunk));
+	if (dump) {
+		dump->Hash = h;
+		memcpy(dump->Chunk, chunk, sizeof(chunk));
+		memcpy(dump->RAMPage, PokeMini_HashRAMPage, sizeof(PokeMini_HashRAMPage));
+	}
+	return h;
+}
+
+int PokeMini_StateHashDiff(const TPokeMini_StateHash *a, const TPokeMini_StateHash *b, char *desc)
+{
+	int i, page, diffs = 0;
+
+	if (desc) desc[0] = 0;
+	for (i=0; i<POKEMINI_SS_CHUNKS; i++) {
+		if (a->Chunk[i] == b->Chunk[i]) continue;
+		if (!diffs++ && desc) {
+			if (i == 0) {
+				for (page=0; (page<15) && (a->RAMPage[page] == b->RAMPage[page]); page++);
+				sprintf(desc, "%s $%04X", PokeMini_HashTags[i], 0x1000 + (page << 8));
+			} else {
+				strcpy(desc, PokeMini_HashTags[i]);
+			}
+		}
+	}
+	return diffs;
+}
+
+void PokeMini_StateHashSwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, PokeMini_HashRAMPage);
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_STATEHASH
+#define POKEMINI_STATEHASH
+
+#include <stdint.h>
+#include "PokeMini.h"
+
+#ifndef TARGET_GNW
+// State hash
+//   64-bit hash of the emulated state for lockstep desync checks. RAM is
+//   hashed per 256 bytes page and only pages written since the previous
+//   call are hashed again, the rest is small or hashed in place. Peers must
+//   run the same core build, LCD pixels and audio output aren't included
+//   since they depend on frontend options
+typedef struct {
+	uint64_t Hash;				// Whole state
+	uint64_t Chunk[POKEMINI_SS_CHUNKS];	// Per savestate chunk, same order
+	uint64_t RAMPage[16];			// Per RAM page from $1000
+} TPokeMini_StateHash;
+
+// Hash running state, call between frames
+//   If dump isn't NULL it gets the hash of every chunk for comparing with
+//   another peer's dump
+uint64_t PokeMini_StateHash(TPokeMini_StateHash *dump);
+
+// Compare dumps, return how many chunks differ
+//   desc gets the first one ("RAM- $1300") if not NULL, 32 chars at most
+int PokeMini_StateHashDiff(const TPokeMini_StateHash *a, const TPokeMini_StateHash *b, char *desc);
+
+// Swap instance state
+void PokeMini_StateHashSwapContext(TPokeMini_Swap *sw);
+#endif
+
+#endif
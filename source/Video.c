@@ -22,21 +22,22 @@
 #include <gw_malloc.h>
 #endif
 
-int VidPixelLayout = 0;
-int VidEnableHighcolor = 0;
+POKEMINI_TLS int VidPixelLayout = 0;
+POKEMINI_TLS int VidEnableHighcolor = 0;
+int VidEnableSIMD = 1;
 #ifndef TARGET_GNW
-uint32_t *VidPalette32 = NULL;
-uint32_t *VidPalColor32 = NULL;
-uint32_t *VidPalColorH32 = NULL;
-TPokeMini_DrawVideo32 PokeMini_VideoBlit32 = NULL;
+POKEMINI_TLS uint32_t *VidPalette32 = NULL;
+POKEMINI_TLS uint32_t *VidPalColor32 = NULL;
+POKEMINI_TLS uint32_t *VidPalColorH32 = NULL;
+POKEMINI_TLS TPokeMini_DrawVideo32 PokeMini_VideoBlit32 = NULL;
 #endif
-uint16_t *VidPalette16 = NULL;
-uint16_t *VidPalColorH16 = NULL;
-uint16_t *VidPalColor16 = NULL;
-TPokeMini_VideoSpec *PokeMini_VideoCurrent = NULL;
-int PokeMini_VideoDepth = 0;
-TPokeMini_DrawVideo16 PokeMini_VideoBlit16 = NULL;
-TPokeMini_DrawVideoPtr PokeMini_VideoBlit = NULL;
+POKEMINI_TLS uint16_t *VidPalette16 = NULL;
+POKEMINI_TLS uint16_t *VidPalColorH16 = NULL;
+POKEMINI_TLS uint16_t *VidPalColor16 = NULL;
+POKEMINI_TLS TPokeMini_VideoSpec *PokeMini_VideoCurrent = NULL;
+POKEMINI_TLS int PokeMini_VideoDepth = 0;
+POKEMINI_TLS TPokeMini_DrawVideo16 PokeMini_VideoBlit16 = NULL;
+POKEMINI_TLS TPokeMini_DrawVideoPtr PokeMini_VideoBlit = NULL;
 
 int PokeMini_SetVideo(TPokeMini_VideoSpec *videospec, int bpp, int dotmatrix, int lcdmode)
 {
@@ -181,6 +182,26 @@ void PokeMini_VideoPalette_Free(void)
 #endif
 }
 
+// Swap instance state
+void PokeMini_VideoSwapContext(TPokeMini_Swap *sw)
+{
+	POKESWAP(sw, VidPixelLayout);
+	POKESWAP(sw, VidEnableHighcolor);
+#ifndef TARGET_GNW
+	POKESWAP(sw, VidPalette32);
+	POKESWAP(sw, VidPalColor32);
+	POKESWAP(sw, VidPalColorH32);
+	POKESWAP(sw, PokeMini_VideoBlit32);
+#endif
+	POKESWAP(sw, VidPalette16);
+	POKESWAP(sw, VidPalColorH16);
+	POKESWAP(sw, VidPalColor16);
+	POKESWAP(sw, PokeMini_VideoCurrent);
+	POKESWAP(sw, PokeMini_VideoDepth);
+	POKESWAP(sw, PokeMini_VideoBlit16);
+	POKESWAP(sw, PokeMini_VideoBlit);
+}
+
 void PokeMini_VideoPalette_Convert(uint32_t bgr32, int pixellayout, uint32_t *out32, uint16_t *out16)
 {
 	int r = GetValH24(bgr32);
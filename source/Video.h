@@ -20,6 +20,7 @@
 #define POKEMINI_VIDEO
 
 #include <stdint.h>
+#include "PMCommon.h"
 #include <retro_inline.h>
 
 #define GetValL24(a) ((a) & 255)
@@ -109,19 +110,20 @@ enum {
 	PokeMini_RGB32
 };
 
-extern int VidPixelLayout;
-extern int VidEnableHighcolor;
-extern uint32_t *VidPalette32;
-extern uint16_t *VidPalette16;
-extern uint16_t *VidPalColorH16;
-extern uint32_t *VidPalColor32;
-extern uint16_t *VidPalColor16;
-extern uint32_t *VidPalColorH32;
-extern TPokeMini_VideoSpec *PokeMini_VideoCurrent;
-extern int PokeMini_VideoDepth;
-extern TPokeMini_DrawVideo16 PokeMini_VideoBlit16;
-extern TPokeMini_DrawVideo32 PokeMini_VideoBlit32;
-extern TPokeMini_DrawVideoPtr PokeMini_VideoBlit;
+extern POKEMINI_TLS int VidPixelLayout;
+extern POKEMINI_TLS int VidEnableHighcolor;
+extern int VidEnableSIMD;	// Vector blitters when built with SSE2 or NEON, 0 = scalar only
+extern POKEMINI_TLS uint32_t *VidPalette32;
+extern POKEMINI_TLS uint16_t *VidPalette16;
+extern POKEMINI_TLS uint16_t *VidPalColorH16;
+extern POKEMINI_TLS uint32_t *VidPalColor32;
+extern POKEMINI_TLS uint16_t *VidPalColor16;
+extern POKEMINI_TLS uint32_t *VidPalColorH32;
+extern POKEMINI_TLS TPokeMini_VideoSpec *PokeMini_VideoCurrent;
+extern POKEMINI_TLS int PokeMini_VideoDepth;
+extern POKEMINI_TLS TPokeMini_DrawVideo16 PokeMini_VideoBlit16;
+extern POKEMINI_TLS TPokeMini_DrawVideo32 PokeMini_VideoBlit32;
+extern POKEMINI_TLS TPokeMini_DrawVideoPtr PokeMini_VideoBlit;
 
 // Set video, return bpp
 int PokeMini_SetVideo(TPokeMini_VideoSpec *videospec, int bpp, int filter, int lcdmode);
@@ -137,4 +139,7 @@ void PokeMini_VideoPalette_16(uint16_t P0Color, uint16_t P1Color, int contrastbo
 void PokeMini_VideoPalette_Index(int index, uint32_t *CustomMonoPal, int contrastboost, int brightoffset);
 void PokeMini_VideoPalette_Free(void);
 
+// Swap instance state
+void PokeMini_VideoSwapContext(TPokeMini_Swap *sw);
+
 #endif
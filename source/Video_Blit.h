@@ -0,0 +1,137 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// One blitter, included by Video_Kernel.h
+// No include guard on purpose, expects:
+//   VIDEO_BLIT     Blitter name, eg: AMatrix
+//   VIDEO_SOURCE   One of VIDEO_SRC_*
+//   VIDEO_FILTER   PokeMini_NoFilter, PokeMini_Matrix or PokeMini_Scanline
+// All tests against them are constant and get folded away
+// VIDEO_BLIT, VIDEO_SOURCE and VIDEO_FILTER are undefined at the end
+
+#define VIDEO_PUT(c) *ptr++ = pix;
+#define VIDEO_PUTMASK(c) *ptr++ = VIDEO_LOOKUP(level * mask[c] >> 8);
+#define VIDEO_COLOR(x) ((VIDEO_SOURCE == VIDEO_SRC_COLORH) ? VIDEO_LOOKUP(src[x] * 256 + old[LCDY + x]) : VIDEO_LOOKUP(src[x]))
+
+static void VIDEO_FN(VIDEO_BLIT)(VIDEO_OUTPUT *output, int pitchW)
+{
+	uint8_t line[96];
+	const uint8_t *src, *old;
+	VIDEO_PIXEL *screen, *ptr, *first, pix;
+#ifdef VIDEO_PALETTE
+	const VIDEO_PIXEL *pal;
+#endif
+#ifdef VIDEO_VECTOR
+	VIDEO_PIXEL dimmed[(VIDEO_FILTER == PokeMini_Matrix) ? 256 * VIDEO_VSPAN * VIDEO_LANES : 1];
+	const VIDEO_PIXEL *cell;
+	TPokeMini_VideoVec vec;
+	int simd = VidEnableSIMD;
+#endif
+	int mask[VIDEO_W];
+	int xk, yk, row, c, level, LCDY;
+
+#ifdef VIDEO_PALETTE
+	if (VIDEO_SOURCE == VIDEO_SRC_COLORH) pal = VIDEO_PALCOLORH;
+	else if (VIDEO_SOURCE == VIDEO_SRC_COLOR) pal = VIDEO_PALCOLOR;
+	else pal = VIDEO_PALETTE;
+#endif
+	pitchW *= (int)(sizeof(VIDEO_OUTPUT) / sizeof(VIDEO_PIXEL));
+	old = PRCColorPixelsOld;
+
+#ifdef VIDEO_VECTOR
+	// Dot-matrix one mask row at a time, each level is dimmed into a
+	// vector of VIDEO_W pixels once, then every LCD pixel is a load + store
+	if ((VIDEO_FILTER == PokeMini_Matrix) && simd) {
+		for (row=0; row<VIDEO_H; row++) {
+			screen = (VIDEO_PIXEL *)output + row * pitchW;
+			if (row && !memcmp(VIDEO_MASK + row * VIDEO_W, VIDEO_MASK + (row - 1) * VIDEO_W, VIDEO_W * sizeof(int))) {
+				for (yk=0; yk<64; yk++) {
+					memcpy(screen, screen - pitchW, 96 * VIDEO_W * sizeof(VIDEO_PIXEL));
+					screen += pitchW * VIDEO_H;
+				}
+				continue;
+			}
+			for (level=0; level<256; level++) {
+				ptr = dimmed + level * VIDEO_VSPAN * VIDEO_LANES;
+				for (c=0; c<VIDEO_VSPAN * VIDEO_LANES; c++) {
+					ptr[c] = VIDEO_LOOKUP(level * VIDEO_MASK[row * VIDEO_W + ((c < VIDEO_W) ? c : VIDEO_W - 1)] >> 8);
+				}
+			}
+			LCDY = 0;
+			for (yk=0; yk<64; yk++) {
+				src = PokeMini_VideoSource(line, LCDY, VIDEO_SOURCE);
+				ptr = screen;
+				for (xk=0; xk<VIDEO_VEND; xk++) {
+					cell = dimmed + src[xk] * VIDEO_VSPAN * VIDEO_LANES;
+					for (c=0; c<VIDEO_VSPAN; c++) {
+						vec = VIDEO_VLOAD(cell + c * VIDEO_LANES);
+						VIDEO_VSTORE(ptr + c * VIDEO_LANES, vec);
+					}
+					ptr += VIDEO_W;
+				}
+				for (; xk<96; xk++) {
+					cell = dimmed + src[xk] * VIDEO_VSPAN * VIDEO_LANES;
+					for (c=0; c<VIDEO_W; c++) *ptr++ = cell[c];
+				}
+				screen += pitchW * VIDEO_H;
+				LCDY += 96;
+			}
+		}
+		return;
+	}
+#endif
+
+	screen = (VIDEO_PIXEL *)output;
+	LCDY = 0;
+	for (yk=0; yk<64; yk++) {
+		src = PokeMini_VideoSource(line, LCDY, VIDEO_SOURCE);
+
+		// Draw VIDEO_H rows, repeated rows are copied
+		first = NULL;
+		for (row=0; row<VIDEO_H; row++) {
+			ptr = screen;
+			if ((VIDEO_FILTER == PokeMini_Scanline) && ((yk * VIDEO_H + row) & 1)) {
+				memset(ptr, 0, 96 * VIDEO_W * sizeof(VIDEO_PIXEL));
+			} else if (first && ((VIDEO_FILTER != PokeMini_Matrix) || !memcmp(VIDEO_MASK + row * VIDEO_W, VIDEO_MASK + (row - 1) * VIDEO_W, VIDEO_W * sizeof(int)))) {
+				memcpy(ptr, first, 96 * VIDEO_W * sizeof(VIDEO_PIXEL));
+			} else if (VIDEO_FILTER == PokeMini_Matrix) {
+				for (c=0; c<VIDEO_W; c++) mask[c] = VIDEO_MASK[row * VIDEO_W + c];
+				for (xk=0; xk<96; xk++) {
+					level = src[xk];
+					VIDEO_REPEAT(VIDEO_W, VIDEO_PUTMASK)
+				}
+				first = screen;
+			} else {
+				for (xk=0; xk<96; xk++) {
+					pix = VIDEO_COLOR(xk);
+					VIDEO_REPEAT(VIDEO_W, VIDEO_PUT)
+				}
+				first = screen;
+			}
+			screen += pitchW;
+		}
+		LCDY += 96;
+	}
+}
+
+#undef VIDEO_PUT
+#undef VIDEO_PUTMASK
+#undef VIDEO_COLOR
+#undef VIDEO_BLIT
+#undef VIDEO_SOURCE
+#undef VIDEO_FILTER
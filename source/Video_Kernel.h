@@ -0,0 +1,172 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Blitter kernel, included by Video_Scale.c once for each scale and depth
+// No include guard on purpose, each blitter comes from Video_Blit.h. Expects:
+//   VIDEO_W, VIDEO_H   Size of each LCD pixel on screen
+//   VIDEO_MASK         Dot-matrix mask, VIDEO_W*VIDEO_H entries, 256 = full intensity
+//   VIDEO_BPP          16, 32 or 8 (8-bits paletted pixels, packed in pairs)
+//   VIDEO_ID           Name suffix, eg: 3x3_16
+// VIDEO_BPP and VIDEO_ID are undefined at the end
+
+#if VIDEO_BPP == 32
+#define VIDEO_PIXEL uint32_t
+#define VIDEO_OUTPUT uint32_t
+#define VIDEO_DRAW TPokeMini_DrawVideo32
+#define VIDEO_PALETTE VidPalette32
+#define VIDEO_PALCOLOR VidPalColor32
+#define VIDEO_PALCOLORH VidPalColorH32
+#elif VIDEO_BPP == 16
+#define VIDEO_PIXEL uint16_t
+#define VIDEO_OUTPUT uint16_t
+#define VIDEO_DRAW TPokeMini_DrawVideo16
+#define VIDEO_PALETTE VidPalette16
+#define VIDEO_PALCOLOR VidPalColor16
+#define VIDEO_PALCOLORH VidPalColorH16
+#else
+#define VIDEO_PIXEL uint8_t
+#define VIDEO_OUTPUT uint16_t
+#define VIDEO_DRAW TPokeMini_DrawVideo16
+#endif
+
+#ifdef VIDEO_PALETTE
+#define VIDEO_LOOKUP(idx) pal[idx]
+#else
+#define VIDEO_LOOKUP(idx) (VIDEO_PIXEL)(idx)
+#endif
+
+// Dot-matrix vector path, one or more overlapping stores per LCD pixel
+// Pixels from VIDEO_VEND onward are scalar so stores never pass the row end
+// Below 6 bytes per LCD pixel most of each store is wasted, scalar wins there
+#if defined(VIDEO_SIMD) && (VIDEO_W * VIDEO_BPP >= 48)
+#define VIDEO_VECTOR
+#define VIDEO_LANES (VIDEO_SIMD / (int)sizeof(VIDEO_PIXEL))
+#define VIDEO_VSPAN ((VIDEO_W + VIDEO_LANES - 1) / VIDEO_LANES)
+#define VIDEO_VEND ((96 * VIDEO_W - VIDEO_VSPAN * VIDEO_LANES) / VIDEO_W + 1)
+#endif
+
+#define VIDEO_FN(name) VIDEO_XJOIN(PokeMini_Video, name, VIDEO_ID)
+
+#define VIDEO_BLIT AScanLine
+#define VIDEO_SOURCE VIDEO_SRC_ANALOG
+#define VIDEO_FILTER PokeMini_Scanline
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 3ScanLine
+#define VIDEO_SOURCE VIDEO_SRC_3SHADES
+#define VIDEO_FILTER PokeMini_Scanline
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 2ScanLine
+#define VIDEO_SOURCE VIDEO_SRC_2SHADES
+#define VIDEO_FILTER PokeMini_Scanline
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT AMatrix
+#define VIDEO_SOURCE VIDEO_SRC_ANALOG
+#define VIDEO_FILTER PokeMini_Matrix
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 3Matrix
+#define VIDEO_SOURCE VIDEO_SRC_3SHADES
+#define VIDEO_FILTER PokeMini_Matrix
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 2Matrix
+#define VIDEO_SOURCE VIDEO_SRC_2SHADES
+#define VIDEO_FILTER PokeMini_Matrix
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT ANone
+#define VIDEO_SOURCE VIDEO_SRC_ANALOG
+#define VIDEO_FILTER PokeMini_NoFilter
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 3None
+#define VIDEO_SOURCE VIDEO_SRC_3SHADES
+#define VIDEO_FILTER PokeMini_NoFilter
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT 2None
+#define VIDEO_SOURCE VIDEO_SRC_2SHADES
+#define VIDEO_FILTER PokeMini_NoFilter
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT Color
+#define VIDEO_SOURCE VIDEO_SRC_COLOR
+#define VIDEO_FILTER PokeMini_NoFilter
+#include "Video_Blit.h"
+
+#define VIDEO_BLIT ColorL
+#define VIDEO_SOURCE VIDEO_SRC_COLOR
+#define VIDEO_FILTER PokeMini_Scanline
+#include "Video_Blit.h"
+
+#ifdef VIDEO_PALCOLORH
+#define VIDEO_BLIT ColorH
+#define VIDEO_SOURCE VIDEO_SRC_COLORH
+#define VIDEO_FILTER PokeMini_NoFilter
+#include "Video_Blit.h"
+#endif
+
+VIDEO_DRAW VIDEO_XJOIN2(PokeMini_GetVideo, VIDEO_ID)(int filter, int lcdmode)
+{
+	// No room for scanlines or dot-matrix at 1x1, only high color applies
+	if ((VIDEO_W * VIDEO_H == 1) && ((filter != PokeMini_Matrix) || (lcdmode != 3))) filter = PokeMini_NoFilter;
+	if (filter == PokeMini_Scanline) {
+		switch (lcdmode) {
+			case 3: return VIDEO_FN(ColorL);
+			case 2: return VIDEO_FN(2ScanLine);
+			case 1: return VIDEO_FN(3ScanLine);
+			default: return VIDEO_FN(AScanLine);
+		}
+	} else if (filter == PokeMini_Matrix) {
+		switch (lcdmode) {
+#ifdef VIDEO_PALCOLORH
+			case 3: return (VidEnableHighcolor) ? VIDEO_FN(ColorH) : VIDEO_FN(Color);
+#else
+			case 3: return VIDEO_FN(Color);
+#endif
+			case 2: return VIDEO_FN(2Matrix);
+			case 1: return VIDEO_FN(3Matrix);
+			default: return VIDEO_FN(AMatrix);
+		}
+	} else {
+		switch (lcdmode) {
+			case 3: return VIDEO_FN(Color);
+			case 2: return VIDEO_FN(2None);
+			case 1: return VIDEO_FN(3None);
+			default: return VIDEO_FN(ANone);
+		}
+	}
+}
+
+#undef VIDEO_PIXEL
+#undef VIDEO_OUTPUT
+#undef VIDEO_DRAW
+#undef VIDEO_PALETTE
+#undef VIDEO_PALCOLOR
+#undef VIDEO_PALCOLORH
+#undef VIDEO_LOOKUP
+#undef VIDEO_FN
+#undef VIDEO_VECTOR
+#undef VIDEO_LANES
+#undef VIDEO_VSPAN
+#undef VIDEO_VEND
+#undef VIDEO_BPP
+#undef VIDEO_ID
@@ -0,0 +1,323 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PokeMini.h"
+#include "Video.h"
+#include "Video_Scale.h"
+
+// All blitters come from Video_Kernel.h and Video_Blit.h, specialized at
+// compile time for each scale, depth, source and filter. A new scale only
+// needs a mask table, a block below and its declarations in Video_Scale.h
+
+#define VIDEO_JOIN(a, b, c) a ## b ## c
+#define VIDEO_XJOIN(a, b, c) VIDEO_JOIN(a, b, c)
+#define VIDEO_JOIN2(a, b) a ## b
+#define VIDEO_XJOIN2(a, b) VIDEO_JOIN2(a, b)
+
+// Unrolled e(0) to e(n-1), for the sub-pixels of each LCD pixel
+#define VIDEO_REP1(e) e(0)
+#define VIDEO_REP2(e) VIDEO_REP1(e) e(1)
+#define VIDEO_REP3(e) VIDEO_REP2(e) e(2)
+#define VIDEO_REP4(e) VIDEO_REP3(e) e(3)
+#define VIDEO_REP5(e) VIDEO_REP4(e) e(4)
+#define VIDEO_REP6(e) VIDEO_REP5(e) e(5)
+#define VIDEO_REP7(e) VIDEO_REP6(e) e(6)
+#define VIDEO_REP8(e) VIDEO_REP7(e) e(7)
+#define VIDEO_REP9(e) VIDEO_REP8(e) e(8)
+#define VIDEO_REP10(e) VIDEO_REP9(e) e(9)
+#define VIDEO_REPEAT(n, e) VIDEO_XJOIN2(VIDEO_REP, n)(e)
+
+// 128-bits vector stores, SSE2 and NEON are baseline on x86-64 and AArch64
+// Picked at compile time, VidEnableSIMD switches back to scalar at runtime
+#ifndef POKEMINI_NOSIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define VIDEO_SIMD 16
+typedef __m128i TPokeMini_VideoVec;
+#define VIDEO_VLOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define VIDEO_VSTORE(p, v) _mm_storeu_si128((__m128i *)(p), (v))
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define VIDEO_SIMD 16
+typedef uint8x16_t TPokeMini_VideoVec;
+#define VIDEO_VLOAD(p) vld1q_u8((const uint8_t *)(p))
+#define VIDEO_VSTORE(p, v) vst1q_u8((uint8_t *)(p), (v))
+#endif
+#endif
+
+// Pixel sources, same order as lcdmode
+enum {
+	VIDEO_SRC_ANALOG = 0,
+	VIDEO_SRC_3SHADES,
+	VIDEO_SRC_2SHADES,
+	VIDEO_SRC_COLOR,
+	VIDEO_SRC_COLORH
+};
+
+// Fetch one LCD row as palette indexes, line is used for the mono shades
+static INLINE const uint8_t *PokeMini_VideoSource(uint8_t *line, int LCDY, int source)
+{
+	const uint8_t *pixD = LCDPixelsD + LCDY;
+	const uint8_t *pixA = LCDPixelsA + LCDY;
+	int xk, shade, pix0, pix1, pixM;
+
+	pix0 = MinxLCD.Pixel0Intensity;
+	pix1 = MinxLCD.Pixel1Intensity;
+	pixM = (pix0 + pix1) >> 1;
+	if (source == VIDEO_SRC_3SHADES) {
+		for (xk=0; xk<96; xk++) {
+			shade = pixD[xk] + pixA[xk];
+			line[xk] = (shade == 2) ? pix1 : (shade == 1) ? pixM : pix0;
+		}
+		return line;
+	} else if (source == VIDEO_SRC_2SHADES) {
+		for (xk=0; xk<96; xk++) line[xk] = pixD[xk] ? pix1 : pix0;
+		return line;
+	} else if (source == VIDEO_SRC_ANALOG) {
+		return pixA;
+	}
+	return PRCColorPixels + LCDY;
+}
+
+static const int LCDMask1x1[1*1] = {
+	256
+};
+
+static const int LCDMask2x2[2*2] = {
+	256, 192,
+	192, 160
+};
+
+static const int LCDMask3x3[3*3] = {
+	240, 256, 128,
+	256, 256, 160,
+	128, 160, 160
+};
+
+static const int LCDMask4x4[4*4] = {
+	240, 256, 240, 128,
+	256, 256, 256, 160,
+	240, 256, 240, 192,
+	128, 160, 192, 160
+};
+
+static const int LCDMask5x5[5*5] = {
+	240, 256, 256, 240, 128,
+	256, 256, 256, 256, 160,
+	256, 256, 256, 256, 160,
+	240, 256, 256, 240, 192,
+	128, 160, 160, 192, 160
+};
+
+static const int LCDMask6x6[6*6] = {
+	240, 256, 256, 256, 240, 128,
+	256, 256, 256, 256, 256, 160,
+	256, 256, 256, 256, 256, 160,
+	256, 256, 256, 256, 256, 160,
+	240, 256, 256, 256, 240, 192,
+	128, 160, 160, 160, 192, 160
+};
+
+static const int LCDMask7x7[7*7] = {
+	240, 256, 256, 256, 256, 240, 128,
+	256, 256, 256, 256, 256, 256, 160,
+	256, 256, 256, 256, 256, 256, 160,
+	256, 256, 256, 256, 256, 256, 160,
+	256, 256, 256, 256, 256, 256, 160,
+	240, 256, 256, 256, 256, 240, 192,
+	128, 160, 160, 160, 160, 192, 160
+};
+
+// 1x1, 96x64
+#define VIDEO_W 1
+#define VIDEO_H 1
+#define VIDEO_MASK LCDMask1x1
+#define VIDEO_BPP 16
+#define VIDEO_ID 1x1_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 1x1_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video1x1 = {
+	1, 1,
+	PokeMini_GetVideo1x1_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo1x1_32
+#endif
+};
+
+// 2x2, 192x128
+#define VIDEO_W 2
+#define VIDEO_H 2
+#define VIDEO_MASK LCDMask2x2
+#define VIDEO_BPP 16
+#define VIDEO_ID 2x2_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 2x2_32
+#include "Video_Kernel.h"
+#endif
+#define VIDEO_BPP 8
+#define VIDEO_ID 2x2_8P
+#include "Video_Kernel.h"
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video2x2 = {
+	2, 2,
+	PokeMini_GetVideo2x2_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo2x2_32
+#endif
+};
+
+const TPokeMini_VideoSpec PokeMini_Video2x2_NDS = {	// For NDS
+	2, 2,
+	PokeMini_GetVideo2x2_8P,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo2x2_32
+#endif
+};
+
+// 3x3, 288x192
+#define VIDEO_W 3
+#define VIDEO_H 3
+#define VIDEO_MASK LCDMask3x3
+#define VIDEO_BPP 16
+#define VIDEO_ID 3x3_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 3x3_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video3x3 = {
+	3, 3,
+	PokeMini_GetVideo3x3_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo3x3_32
+#endif
+};
+
+// 4x4, 384x256
+#define VIDEO_W 4
+#define VIDEO_H 4
+#define VIDEO_MASK LCDMask4x4
+#define VIDEO_BPP 16
+#define VIDEO_ID 4x4_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 4x4_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video4x4 = {
+	4, 4,
+	PokeMini_GetVideo4x4_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo4x4_32
+#endif
+};
+
+// 5x5, 480x320
+#define VIDEO_W 5
+#define VIDEO_H 5
+#define VIDEO_MASK LCDMask5x5
+#define VIDEO_BPP 16
+#define VIDEO_ID 5x5_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 5x5_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video5x5 = {
+	5, 5,
+	PokeMini_GetVideo5x5_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo5x5_32
+#endif
+};
+
+// 6x6, 576x384
+#define VIDEO_W 6
+#define VIDEO_H 6
+#define VIDEO_MASK LCDMask6x6
+#define VIDEO_BPP 16
+#define VIDEO_ID 6x6_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 6x6_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video6x6 = {
+	6, 6,
+	PokeMini_GetVideo6x6_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo6x6_32
+#endif
+};
+
+// 7x7, 672x448
+#define VIDEO_W 7
+#define VIDEO_H 7
+#define VIDEO_MASK LCDMask7x7
+#define VIDEO_BPP 16
+#define VIDEO_ID 7x7_16
+#include "Video_Kernel.h"
+#ifndef TARGET_GNW
+#define VIDEO_BPP 32
+#define VIDEO_ID 7x7_32
+#include "Video_Kernel.h"
+#endif
+#undef VIDEO_W
+#undef VIDEO_H
+#undef VIDEO_MASK
+
+const TPokeMini_VideoSpec PokeMini_Video7x7 = {
+	7, 7,
+	PokeMini_GetVideo7x7_16,
+#ifndef TARGET_GNW
+	PokeMini_GetVideo7x7_32
+#endif
+};
@@ -0,0 +1,55 @@
+/*
+  PokeMini - Pokmon-Mini Emulator
+  Copyright (C) 2009-2012  JustBurn
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POKEMINI_VIDEO_SCALE
+#define POKEMINI_VIDEO_SCALE
+
+#include <stdint.h>
+
+// Video specs, 96x64 up to 672x448
+extern const TPokeMini_VideoSpec PokeMini_Video1x1;
+extern const TPokeMini_VideoSpec PokeMini_Video2x2;
+extern const TPokeMini_VideoSpec PokeMini_Video3x3;
+extern const TPokeMini_VideoSpec PokeMini_Video4x4;
+extern const TPokeMini_VideoSpec PokeMini_Video5x5;
+extern const TPokeMini_VideoSpec PokeMini_Video6x6;
+extern const TPokeMini_VideoSpec PokeMini_Video7x7;
+extern const TPokeMini_VideoSpec PokeMini_Video2x2_NDS;	// For NDS
+
+// Return the best blitter
+TPokeMini_DrawVideo16 PokeMini_GetVideo1x1_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo2x2_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo3x3_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo4x4_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo5x5_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo6x6_16(int filter, int lcdmode);
+TPokeMini_DrawVideo16 PokeMini_GetVideo7x7_16(int filter, int lcdmode);
+#ifndef TARGET_GNW
+TPokeMini_DrawVideo32 PokeMini_GetVideo1x1_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo2x2_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo3x3_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo4x4_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo5x5_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo6x6_32(int filter, int lcdmode);
+TPokeMini_DrawVideo32 PokeMini_GetVideo7x7_32(int filter, int lcdmode);
+#endif
+
+// 8-bits paletted pixels packed in pairs, the color palette should be in CRAM
+TPokeMini_DrawVideo16 PokeMini_GetVideo2x2_8P(int filter, int lcdmode);
+
+#endif